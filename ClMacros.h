@@ -29,4 +29,8 @@
 #define CL_TO_BCD_BYTE(val)       ((uint8_t)((val % 10) | ((val / 10) % 10) << 4))
 #define CL_FROM_BCD_BYTE(bcd)     ((bcd & 0xf) + ((bcd >> 4) & 0xf) * 10)
 
+#ifndef CL_CACHE_LINE_SIZE
+#define CL_CACHE_LINE_SIZE        64
+#endif
+
 #endif //CODE_LIB_MACROS_H_INCLUDED
@@ -0,0 +1,74 @@
+/*!
+    ClSimd.h
+
+    x86 SIMD support for library kernels. Kernels are built with per function
+    target attribute and selected at runtime by detected CPU features, so
+    no special compiler flags are needed. Other architectures use portable code.
+    Define CL_SIMD_DISABLE to build portable code only.
+*/
+#ifndef CODE_LIB_SIMD_H_INCLUDED
+#define CODE_LIB_SIMD_H_INCLUDED
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(CL_SIMD_DISABLE)
+
+#define CL_SIMD_X86
+
+#define CL_CPU_SSE2               (1UL << 0)
+#define CL_CPU_SSSE3              (1UL << 1)
+#define CL_CPU_SSE41              (1UL << 2)
+#define CL_CPU_SSE42              (1UL << 3)
+#define CL_CPU_PCLMUL             (1UL << 4)
+#define CL_CPU_AVX2               (1UL << 5)
+#define CL_CPU_DETECTED           (1UL << 31)
+
+#define CL_SIMD_TARGET(isa)       __attribute__((target(isa)))
+
+/* Vector types of compiler builtins, *u types are for unaligned access */
+typedef char ClVec16_t __attribute__((vector_size(16)));
+typedef char ClVec16u_t __attribute__((vector_size(16), aligned(1), may_alias));
+typedef char ClVec32_t __attribute__((vector_size(32)));
+typedef char ClVec32u_t __attribute__((vector_size(32), aligned(1), may_alias));
+
+static inline void _vClCpuId(uint32_t ulLeaf, uint32_t *pulRegs) {
+	__asm__ volatile ("cpuid" : "=a"(pulRegs[0]), "=b"(pulRegs[1]), "=c"(pulRegs[2]), "=d"(pulRegs[3]) : "a"(ulLeaf), "c"(0));
+}
+
+static inline uint32_t _ulClCpuDetect(void) {
+	uint32_t regs[4];
+	uint32_t features = CL_CPU_DETECTED;
+	_vClCpuId(0, regs);
+	uint32_t maxLeaf = regs[0];
+	_vClCpuId(1, regs);
+	if (regs[3] & (1UL << 26)) features |= CL_CPU_SSE2;
+	if (regs[2] & (1UL << 9))  features |= CL_CPU_SSSE3;
+	if (regs[2] & (1UL << 19)) features |= CL_CPU_SSE41;
+	if (regs[2] & (1UL << 20)) features |= CL_CPU_SSE42;
+	if (regs[2] & (1UL << 1))  features |= CL_CPU_PCLMUL;
+	/* AVX registers state must be saved by OS */
+	if ((regs[2] & (1UL << 27)) && (regs[2] & (1UL << 28)) && (maxLeaf >= 7)) {
+		uint32_t xcr0, xcr0h;
+		__asm__ volatile ("xgetbv" : "=a"(xcr0), "=d"(xcr0h) : "c"(0));
+		libUNUSED(xcr0h);
+		_vClCpuId(7, regs);
+		if (((xcr0 & 0x6) == 0x6) && (regs[1] & (1UL << 5))) features |= CL_CPU_AVX2;
+	}
+	return features;
+}
+
+/*!
+	@brief Get CPU features, detected once per translation unit
+	@return CL_CPU_* flags
+*/
+static inline uint32_t ulClCpuFeatures(void) {
+	static uint32_t features;
+	uint32_t res = __atomic_load_n(&features, __ATOMIC_RELAXED);
+	if (res == 0) {
+		res = _ulClCpuDetect();
+		__atomic_store_n(&features, res, __ATOMIC_RELAXED);
+	}
+	return res;
+}
+
+#endif
+
+#endif //CODE_LIB_SIMD_H_INCLUDED
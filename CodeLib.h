@@ -27,7 +27,7 @@ typedef __PTRDIFF_TYPE__       ptrdiff_t;
 
 #define CL_FALSE 	           ((uint8_t)( 0 ))
 #define CL_TRUE	               !CL_FALSE
-#define CL_PRIVATE(size)       uint32_t __private[(size + sizeof(void *) - 1) >> 2]
+#define CL_PRIVATE(size)       void *__private[((size) + sizeof(void *) - 1) / sizeof(void *)]
 
 #define libNULL                ((void *)0)
 
@@ -45,32 +45,39 @@ typedef void** cl_tuple_t;
 #define va_start(v,l)          __builtin_va_start(v,l)
 #define va_end(v)              __builtin_va_end(v)
 #define va_arg(v,l)            __builtin_va_arg(v,l)
+#define va_copy(d,s)           __builtin_va_copy(d,s)
 
+/* Sizes are exact on 32 bit targets, on 64 bit host (tests, benchmarks) private data only has to fit */
 #define LIB_ASSERRT_STRUCTURE_CAST(private_type, public_type, prv_size_def, def_file) \
-    _Static_assert(sizeof(private_type) == sizeof(public_type), "In "#def_file" data structure size of "#public_type" doesn't match, check "#prv_size_def)
+    _Static_assert((sizeof(void *) == 4)? (sizeof(private_type) == sizeof(public_type)): \
+                   ((sizeof(private_type) <= sizeof(public_type)) && (_Alignof(private_type) <= _Alignof(public_type))), \
+                   "In "#def_file" data structure size of "#public_type" doesn't match, check "#prv_size_def)
 #define LIB_ASSERRT_STRUCTURE_PROP(private_type, public_type, prop, def_file) \
     _Static_assert((offsetof(private_type, prop) == offsetof(public_type, prop)), "In "def_file" "#public_type" property "#prop" order doesn't match");
 
 #include "ClMacros.h"
+#include "ClSimd.h"
 #include "Math/Math.h"
 #include "DataStructures/LinkedList.h"
 #include "Workflow/CooperativeMultitasking.h"
 #include "Workflow/MachineState.h"
 #include "Workflow/Event.h"
-#include "DataStructures/SimpleCircularBuffer.h"
 #include "DataStructures/Mem.h"
+#include "DataStructures/SimpleCircularBuffer.h"
 #include "DataStructures/MedianFilter.h"
 #include "Crypto/Crc.h"
 #include "Crypto/Hash.h"
 #include "Binary/BitOp.h"
 #include "Converters/StringConverter.h"
 #include "Converters/CharsetEncoding.h"
-#include "Converters/Base64Encoding.h"
 #include "DataStructures/DateTime.h"
 #include "DataStructures/Str.h"
+#include "DataStructures/HashMap.h"
 #include "DataStructures/CircularBuffer.h"
+#include "DataStructures/MpscBuffer.h"
 #include "DataStructures/Fifo.h"
 #include "DataStructures/Stream.h"
+#include "Converters/Base64Encoding.h"
 
 #include "DataStructures/Printf.h"
 
@@ -14,6 +14,93 @@ static inline int32_t lBase64EncodeBufferRequired(uint32_t ulLength) {
 
 int32_t lBase64DecodeBufferRequired(const uint8_t *pucBase64, uint32_t ulLength);
 
+/*!
+	Incremental encoder/decoder state, keeps input tail which is not a whole block yet
+*/
+typedef struct {
+	uint8_t aucPending[3];
+	uint8_t ucPendingCount;
+	uint8_t bPadded;
+} Base64Context_t;
+
+/*!
+	@brief Initialize context before encoding or decoding
+	@param[in] pxContext       Context
+*/
+void vBase64ContextInit(Base64Context_t *pxContext);
+
+/*!
+	@brief Encode data chunk to fifo, up to 2 leftover bytes are kept in context
+	@param[in] pxContext       Context
+	@param[in] pxFifo          Output fifo
+	@param[in] pucData         Data
+	@param[in] ulLength        Data length
+	@return Consumed data bytes count, less than ulLength if fifo is full, <0 if error
+*/
+int32_t lBase64EncodeUpdate(Base64Context_t *pxContext, Fifo_t *pxFifo, const uint8_t *pucData, uint32_t ulLength);
+
+/*!
+	@brief Encode leftover bytes with padding to fifo
+	@param[in] pxContext       Context
+	@param[in] pxFifo          Output fifo
+	@return Written chars count, <0 if error or no space in fifo, it may be called again then
+*/
+int32_t lBase64EncodeFinal(Base64Context_t *pxContext, Fifo_t *pxFifo);
+
+/*!
+	@brief Decode chunk of base64 text to fifo, up to 3 chars of incomplete block are kept in context
+	@param[in] pxContext       Context
+	@param[in] pxFifo          Output fifo
+	@param[in] pucBase64       Base64 chars
+	@param[in] ulLength        Chars count
+	@return Consumed chars count, less than ulLength if fifo is full, <0 if input is invalid or any after padding
+*/
+int32_t lBase64DecodeUpdate(Base64Context_t *pxContext, Fifo_t *pxFifo, const uint8_t *pucBase64, uint32_t ulLength);
+
+/*!
+	@brief Finish decoding
+	@param[in] pxContext       Context
+	@return 0 if ok, <0 if input ended with incomplete block
+*/
+int32_t lBase64DecodeFinal(Base64Context_t *pxContext);
+
+/*!
+	@brief Encode data chunk to stream output
+	@param[in] pxStream        Stream
+	@param[in] pxContext       Context
+	@param[in] pucData         Data
+	@param[in] ulLength        Data length
+	@return Consumed data bytes count, <0 if error
+*/
+static inline int32_t lStreamBase64Encode(Stream_t *pxStream, Base64Context_t *pxContext, const uint8_t *pucData, uint32_t ulLength) {
+	if(pxStream == libNULL) return STREAM_FAIL;
+	return lBase64EncodeUpdate(pxContext, pxStream->pxOFifo, pucData, ulLength);
+}
+
+/*!
+	@brief Encode leftover bytes with padding to stream output
+	@param[in] pxStream        Stream
+	@param[in] pxContext       Context
+	@return Written chars count, <0 if error
+*/
+static inline int32_t lStreamBase64EncodeFinal(Stream_t *pxStream, Base64Context_t *pxContext) {
+	if(pxStream == libNULL) return STREAM_FAIL;
+	return lBase64EncodeFinal(pxContext, pxStream->pxOFifo);
+}
+
+/*!
+	@brief Decode chunk of base64 text to stream output
+	@param[in] pxStream        Stream
+	@param[in] pxContext       Context
+	@param[in] pucBase64       Base64 chars
+	@param[in] ulLength        Chars count
+	@return Consumed chars count, <0 if error
+*/
+static inline int32_t lStreamBase64Decode(Stream_t *pxStream, Base64Context_t *pxContext, const uint8_t *pucBase64, uint32_t ulLength) {
+	if(pxStream == libNULL) return STREAM_FAIL;
+	return lBase64DecodeUpdate(pxContext, pxStream->pxOFifo, pucBase64, ulLength);
+}
+
 /*!
   Snake notation
 */
@@ -24,6 +111,14 @@ int32_t base64_decode(uint8_t *out_data, uint32_t size, const uint8_t *base64, u
 static inline int32_t base64_encode_buffer_required(uint32_t length) __attribute__((alias ("lBase64EncodeBufferRequired")));
 int32_t base64_decode_buffer_required(const uint8_t *base64, uint32_t length);
 
+typedef Base64Context_t base64_context_t;
+
+void base64_context_init(base64_context_t *context);
+int32_t base64_encode_update(base64_context_t *context, fifo_t *fifo, const uint8_t *data, uint32_t length);
+int32_t base64_encode_final(base64_context_t *context, fifo_t *fifo);
+int32_t base64_decode_update(base64_context_t *context, fifo_t *fifo, const uint8_t *base64, uint32_t length);
+int32_t base64_decode_final(base64_context_t *context);
+
 #ifdef __cplusplus
 }
 #endif
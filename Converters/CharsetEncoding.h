@@ -7,6 +7,17 @@ extern "C" {
 
 uint32_t ulAsciiToUtf8Mesure(const uint8_t *pucAsciiStr, uint32_t ulLen);
 uint32_t ulAsciiToUtf8(const uint8_t *pucAsciiStr, uint32_t lLen, uint8_t *pucUtf8Str);
+
+/*!
+  @brief Convert CP1251 string to UTF-8 in one pass, stops before char which does not fit output
+  @param[in] pucAsciiStr     CP1251 string
+  @param[in] ulLen           String length
+  @param[out] pucUtf8Str     Output buffer
+  @param[in] ulSize          Output buffer size
+  @param[out] pulConverted   Count of converted input chars, optional
+  @return Bytes written to output
+*/
+uint32_t ulAsciiToUtf8Bounded(const uint8_t *pucAsciiStr, uint32_t ulLen, uint8_t *pucUtf8Str, uint32_t ulSize, uint32_t *pulConverted);
   
 /*!
   Snake notation
@@ -14,6 +25,7 @@ uint32_t ulAsciiToUtf8(const uint8_t *pucAsciiStr, uint32_t lLen, uint8_t *pucUt
   
 uint32_t ascii_to_utf8(const uint8_t *ascii_str, uint32_t len, uint8_t *utf8_str);
 uint32_t ascii_to_utf8_mesure(const uint8_t *ascii_str, uint32_t len);
+uint32_t ascii_to_utf8_bounded(const uint8_t *ascii_str, uint32_t len, uint8_t *utf8_str, uint32_t size, uint32_t *converted);
   
 #ifdef __cplusplus
 }
@@ -8,7 +8,7 @@ static const uint8_t encodeTable[64] = {
 };
 static const uint8_t decodeTable[80] = {
                                                 62, -1, -1, -1, 63,
-    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, 00, -1, -1,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
     -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
     15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
     -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
@@ -17,13 +17,132 @@ static const uint8_t decodeTable[80] = {
 static const uint8_t encShift[4] = {2, 4, 6, 8};
 static const uint8_t dataShift[4] = {8, 4, 2, 0};
 
+#ifdef CL_SIMD_X86
+
+/*
+  Block kernels after W. Mula, D. Lemire "Faster Base64 Encoding and Decoding Using AVX2 Instructions".
+  Decoder takes only blocks of valid alphabet chars, block with '=' or invalid char is left to scalar code,
+  so the result and error handling are the same as for scalar path.
+ */
+
+typedef unsigned char _B64VecU16_t __attribute__((vector_size(16)));
+typedef unsigned char _B64VecU32_t __attribute__((vector_size(32)));
+typedef short _B64Vec8s_t __attribute__((vector_size(16)));
+typedef short _B64Vec16s_t __attribute__((vector_size(32)));
+typedef int _B64Vec4i_t __attribute__((vector_size(16)));
+typedef int _B64Vec8i_t __attribute__((vector_size(32)));
+typedef long long _B64Vec2l_t __attribute__((vector_size(16)));
+typedef long long _B64Vec4l_t __attribute__((vector_size(32)));
+
+#define _B64_LANE(...)            __VA_ARGS__
+#define _B64_LANES(...)           __VA_ARGS__, __VA_ARGS__
+
+/* Every 3 bytes to 4 bytes b1,b0,b2,b1, sextets are cut out with multiplies */
+#define _B64_ENC_SHUFFLE          1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+/* Offset to ASCII for reduced index: 26..51, 52..61, 62, 63, 0..25 */
+#define _B64_ENC_OFFSETS          'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+                                  '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+/* Char classes by low and high nibble, char is invalid if classes intersect */
+#define _B64_DEC_LUT_LO           0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A
+#define _B64_DEC_LUT_HI           0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+#define _B64_DEC_ROLL             0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+/* Packed 3 bytes of every 32-bit word to the first 12 bytes */
+#define _B64_DEC_SHUFFLE          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+
+/* Return count of consumed input bytes, 4 chars are written per 3 bytes */
+CL_SIMD_TARGET("avx2")
+static uint32_t _ulBase64EncodeAvx2(uint8_t *pucOut, const uint8_t *pucData, uint32_t ulLength) {
+	uint32_t i = 0;
+	/* Lanes are loaded from data and data + 12, 4 bytes over block are read */
+	for (; i + 28 <= ulLength; i += 24, pucOut += 32) {
+		_B64Vec4l_t in = __builtin_ia32_insert128i256((_B64Vec4l_t){0}, (_B64Vec2l_t)*(const ClVec16u_t *)(pucData + i), 0);
+		in = __builtin_ia32_insert128i256(in, (_B64Vec2l_t)*(const ClVec16u_t *)(pucData + i + 12), 1);
+		ClVec32_t v = __builtin_ia32_pshufb256((ClVec32_t)in, (ClVec32_t){_B64_LANES(_B64_ENC_SHUFFLE)});
+		_B64Vec16s_t hi = __builtin_ia32_pmulhuw256((_B64Vec16s_t)((_B64Vec8i_t)v & 0x0FC0FC00), (_B64Vec16s_t)((_B64Vec8i_t){0} + 0x04000040));
+		_B64Vec16s_t lo = (_B64Vec16s_t)((_B64Vec8i_t)v & 0x003F03F0) * (_B64Vec16s_t)((_B64Vec8i_t){0} + 0x01000010);
+		_B64VecU32_t index = (_B64VecU32_t)(hi | lo);
+		_B64VecU32_t reduced = ((_B64VecU32_t)(index > 51) & (index - 51)) | ((_B64VecU32_t)(index < 26) & 13);
+		ClVec32_t offset = __builtin_ia32_pshufb256((ClVec32_t){_B64_LANES(_B64_ENC_OFFSETS)}, (ClVec32_t)reduced);
+		*(ClVec32u_t *)pucOut = (ClVec32_t)index + offset;
+	}
+	return i;
+}
+
+CL_SIMD_TARGET("ssse3")
+static uint32_t _ulBase64EncodeSsse3(uint8_t *pucOut, const uint8_t *pucData, uint32_t ulLength) {
+	uint32_t i = 0;
+	for (; i + 16 <= ulLength; i += 12, pucOut += 16) {
+		ClVec16_t v = __builtin_ia32_pshufb128(*(const ClVec16u_t *)(pucData + i), (ClVec16_t){_B64_LANE(_B64_ENC_SHUFFLE)});
+		_B64Vec8s_t hi = __builtin_ia32_pmulhuw128((_B64Vec8s_t)((_B64Vec4i_t)v & 0x0FC0FC00), (_B64Vec8s_t)((_B64Vec4i_t){0} + 0x04000040));
+		_B64Vec8s_t lo = (_B64Vec8s_t)((_B64Vec4i_t)v & 0x003F03F0) * (_B64Vec8s_t)((_B64Vec4i_t){0} + 0x01000010);
+		_B64VecU16_t index = (_B64VecU16_t)(hi | lo);
+		_B64VecU16_t reduced = ((_B64VecU16_t)(index > 51) & (index - 51)) | ((_B64VecU16_t)(index < 26) & 13);
+		ClVec16_t offset = __builtin_ia32_pshufb128((ClVec16_t){_B64_LANE(_B64_ENC_OFFSETS)}, (ClVec16_t)reduced);
+		*(ClVec16u_t *)pucOut = (ClVec16_t)index + offset;
+	}
+	return i;
+}
+
+/* Return count of consumed chars, 3 bytes are written per 4 chars */
+CL_SIMD_TARGET("avx2")
+static uint32_t _ulBase64DecodeAvx2(uint8_t *pucOut, uint32_t ulSize, const uint8_t *pucBase64, uint32_t ulLength) {
+	uint32_t i = 0;
+	/* Lanes are stored to out and out + 12, 4 bytes over block are written */
+	for (; (i + 32 <= ulLength) && ((i >> 2) * 3 + 28 <= ulSize); i += 32, pucOut += 24) {
+		ClVec32_t in = *(const ClVec32u_t *)(pucBase64 + i);
+		ClVec32_t hiNibbles = (ClVec32_t)((_B64Vec16s_t)in >> 4) & 0x0F;
+		ClVec32_t loNibbles = in & 0x0F;
+		ClVec32_t invalid = __builtin_ia32_pshufb256((ClVec32_t){_B64_LANES(_B64_DEC_LUT_LO)}, loNibbles) &
+		                    __builtin_ia32_pshufb256((ClVec32_t){_B64_LANES(_B64_DEC_LUT_HI)}, hiNibbles);
+		if (__builtin_ia32_pmovmskb256(invalid != 0))
+			break;
+		ClVec32_t roll = __builtin_ia32_pshufb256((ClVec32_t){_B64_LANES(_B64_DEC_ROLL)}, (in == '/') + hiNibbles);
+		_B64Vec16s_t pairs = __builtin_ia32_pmaddubsw256(in + roll, (ClVec32_t)((_B64Vec8i_t){0} + 0x01400140));
+		_B64Vec8i_t words = __builtin_ia32_pmaddwd256(pairs, (_B64Vec16s_t)((_B64Vec8i_t){0} + 0x00011000));
+		_B64Vec4l_t out = (_B64Vec4l_t)__builtin_ia32_pshufb256((ClVec32_t)words, (ClVec32_t){_B64_LANES(_B64_DEC_SHUFFLE)});
+		*(ClVec16u_t *)pucOut = (ClVec16_t)__builtin_ia32_extract128i256(out, 0);
+		*(ClVec16u_t *)(pucOut + 12) = (ClVec16_t)__builtin_ia32_extract128i256(out, 1);
+	}
+	return i;
+}
+
+CL_SIMD_TARGET("ssse3")
+static uint32_t _ulBase64DecodeSsse3(uint8_t *pucOut, uint32_t ulSize, const uint8_t *pucBase64, uint32_t ulLength) {
+	uint32_t i = 0;
+	for (; (i + 16 <= ulLength) && ((i >> 2) * 3 + 16 <= ulSize); i += 16, pucOut += 12) {
+		ClVec16_t in = *(const ClVec16u_t *)(pucBase64 + i);
+		ClVec16_t hiNibbles = (ClVec16_t)((_B64Vec8s_t)in >> 4) & 0x0F;
+		ClVec16_t loNibbles = in & 0x0F;
+		ClVec16_t invalid = __builtin_ia32_pshufb128((ClVec16_t){_B64_LANE(_B64_DEC_LUT_LO)}, loNibbles) &
+		                    __builtin_ia32_pshufb128((ClVec16_t){_B64_LANE(_B64_DEC_LUT_HI)}, hiNibbles);
+		if (__builtin_ia32_pmovmskb128(invalid != 0))
+			break;
+		ClVec16_t roll = __builtin_ia32_pshufb128((ClVec16_t){_B64_LANE(_B64_DEC_ROLL)}, (in == '/') + hiNibbles);
+		_B64Vec8s_t pairs = __builtin_ia32_pmaddubsw128(in + roll, (ClVec16_t)((_B64Vec4i_t){0} + 0x01400140));
+		_B64Vec4i_t words = __builtin_ia32_pmaddwd128(pairs, (_B64Vec8s_t)((_B64Vec4i_t){0} + 0x00011000));
+		*(ClVec16u_t *)pucOut = __builtin_ia32_pshufb128((ClVec16_t)words, (ClVec16_t){_B64_LANE(_B64_DEC_SHUFFLE)});
+	}
+	return i;
+}
+
+#endif /* CL_SIMD_X86 */
+
 int32_t lBase64Encode(uint8_t *pucOutBase64, uint32_t ulSize, const uint8_t *pucData, uint32_t ulLength) {
 	if((ulSize < (uint32_t)lBase64EncodeBufferRequired(ulLength)) || (pucData == libNULL))
 	    return -1;
 	int32_t bufIndex = 0;
 	uint8_t encode;
 	uint8_t left = 0;
-	for(uint32_t i = 0; i < ulLength; i++) {
+	uint32_t i = 0;
+#ifdef CL_SIMD_X86
+	uint32_t features = ulClCpuFeatures();
+	if (features & CL_CPU_AVX2)
+		i = _ulBase64EncodeAvx2(pucOutBase64, pucData, ulLength);
+	if (features & CL_CPU_SSSE3)
+		i += _ulBase64EncodeSsse3(pucOutBase64 + i / 3 * 4, pucData + i, ulLength - i);
+	bufIndex = i / 3 * 4;
+#endif
+	for(; i < ulLength; i++) {
 		encode = left | pucData[i] >> encShift[bufIndex & 3];
 		pucOutBase64[bufIndex] = encodeTable[encode & 0x3f];
 		bufIndex++;
@@ -43,10 +162,23 @@ int32_t lBase64Decode(uint8_t *pucOutData, uint32_t ulSize, const uint8_t *pucBa
 	int32_t bufIndex = 0;
 	uint8_t left = 0;
 	uint8_t sextet;
-	for (uint32_t i = 0; i < ulLength; i++) {
+	uint32_t i = 0;
+#ifdef CL_SIMD_X86
+	uint32_t features = ulClCpuFeatures();
+	if (features & CL_CPU_AVX2)
+		i = _ulBase64DecodeAvx2(pucOutData, ulSize, pucBase64, ulLength);
+	if (features & CL_CPU_SSSE3)
+		i += _ulBase64DecodeSsse3(pucOutData + (i >> 2) * 3, ulSize - (i >> 2) * 3, pucBase64 + i, ulLength - i);
+	bufIndex = (i >> 2) * 3;
+#endif
+	for (; i < ulLength; i++) {
 	    sextet = pucBase64[i];
-		if (((i & 3) >= 2) && pucOutData[i] == '=')
+		if (((i & 3) >= 2) && (sextet == '=')) {
+			/* Padding only ends the text: "xx==" or "xxx=" */
+			if ((i + 1 != ulLength) && ((i + 2 != ulLength) || (pucBase64[i + 1] != '=')))
+				return -1;
 			break;
+		}
 		if ((sextet < 43) || (sextet > 122) || ((sextet = decodeTable[sextet - 43]) >= 64))
 			return -1;
 		pucOutData[bufIndex] = left;
@@ -67,6 +199,128 @@ int32_t lBase64DecodeBufferRequired(const uint8_t *pucBase64, uint32_t ulLength)
     return size;
 }
 
+/* Stack buffer for incremental coding, input block of encoder, 128 chars of output */
+#define _BASE64_CHUNK_SIZE    96
+
+void vBase64ContextInit(Base64Context_t *pxContext) {
+	if (pxContext != libNULL) {
+		pxContext->ucPendingCount = 0;
+		pxContext->bPadded = CL_FALSE;
+	}
+}
+
+int32_t lBase64EncodeUpdate(Base64Context_t *pxContext, Fifo_t *pxFifo, const uint8_t *pucData, uint32_t ulLength) {
+	if ((pxContext == libNULL) || ((pucData == libNULL) && ulLength))
+		return -1;
+	uint8_t chunk[_BASE64_CHUNK_SIZE / 3 * 4];
+	uint32_t consumed = 0;
+	while (consumed < ulLength) {
+		uint32_t rest = ulLength - consumed;
+		if (pxContext->ucPendingCount + rest < 3) {
+			mem_cpy(&pxContext->aucPending[pxContext->ucPendingCount], pucData + consumed, rest);
+			pxContext->ucPendingCount += rest;
+			consumed = ulLength;
+			break;
+		}
+		int32_t space = lFifoAvailableToWrite(pxFifo);
+		if (space < 0)
+			return -1;
+		if (space < 4)
+			break;
+		const uint8_t *block = pucData + consumed;
+		uint32_t take = CL_MIN(rest, (uint32_t)space / 4 * 3);
+		take = CL_MIN(take, _BASE64_CHUNK_SIZE);
+		take -= take % 3;
+		if (pxContext->ucPendingCount) {
+			take = 3 - pxContext->ucPendingCount;
+			mem_cpy(&pxContext->aucPending[pxContext->ucPendingCount], block, take);
+			block = pxContext->aucPending;
+		}
+		int32_t encoded = lBase64Encode(chunk, sizeof(chunk), block, (block == pxContext->aucPending)? 3: take);
+		if (lFifoWriteAll(pxFifo, chunk, encoded) != encoded)
+			return -1;
+		pxContext->ucPendingCount = 0;
+		consumed += take;
+	}
+	return consumed;
+}
+
+int32_t lBase64EncodeFinal(Base64Context_t *pxContext, Fifo_t *pxFifo) {
+	if (pxContext == libNULL)
+		return -1;
+	if (!pxContext->ucPendingCount)
+		return 0;
+	uint8_t quad[4];
+	int32_t encoded = lBase64Encode(quad, sizeof(quad), pxContext->aucPending, pxContext->ucPendingCount);
+	if (lFifoWriteAll(pxFifo, quad, encoded) != encoded)
+		return -1;
+	pxContext->ucPendingCount = 0;
+	return encoded;
+}
+
+int32_t lBase64DecodeUpdate(Base64Context_t *pxContext, Fifo_t *pxFifo, const uint8_t *pucBase64, uint32_t ulLength) {
+	if ((pxContext == libNULL) || ((pucBase64 == libNULL) && ulLength))
+		return -1;
+	uint8_t chunk[_BASE64_CHUNK_SIZE];
+	uint8_t quad[4];
+	uint32_t consumed = 0;
+	while (consumed < ulLength) {
+		/* Padding ends the data */
+		if (pxContext->bPadded)
+			return -1;
+		uint32_t rest = ulLength - consumed;
+		if (pxContext->ucPendingCount + rest < 4) {
+			mem_cpy(&pxContext->aucPending[pxContext->ucPendingCount], pucBase64 + consumed, rest);
+			pxContext->ucPendingCount += rest;
+			consumed = ulLength;
+			break;
+		}
+		int32_t space = lFifoAvailableToWrite(pxFifo);
+		if (space < 0)
+			return -1;
+		if (space < 3)
+			break;
+		const uint8_t *block = pucBase64 + consumed;
+		uint32_t take = CL_MIN(rest, (uint32_t)space / 3 * 4);
+		take = CL_MIN(take, _BASE64_CHUNK_SIZE / 3 * 4);
+		take &= ~3;
+		uint32_t length = take;
+		if (pxContext->ucPendingCount) {
+			take = 4 - pxContext->ucPendingCount;
+			mem_cpy(quad, pxContext->aucPending, pxContext->ucPendingCount);
+			mem_cpy(&quad[pxContext->ucPendingCount], block, take);
+			block = quad;
+			length = 4;
+		}
+		int32_t decoded = lBase64Decode(chunk, sizeof(chunk), block, length);
+		if (decoded < 0)
+			return -1;
+		if ((uint32_t)decoded < length / 4 * 3) {
+			/* Decoder stops at padded block, nothing may follow it */
+			if (((uint32_t)decoded / 3 + 1) * 4 < length)
+				return -1;
+			pxContext->bPadded = CL_TRUE;
+		}
+		if (lFifoWriteAll(pxFifo, chunk, decoded) != decoded)
+			return -1;
+		pxContext->ucPendingCount = 0;
+		consumed += take;
+	}
+	return consumed;
+}
+
+int32_t lBase64DecodeFinal(Base64Context_t *pxContext) {
+	if ((pxContext == libNULL) || pxContext->ucPendingCount)
+		return -1;
+	return 0;
+}
+
 int32_t base64_encode(uint8_t *out_base64, uint32_t size, const uint8_t *data, uint32_t length) __attribute__((alias ("lBase64Encode")));
 int32_t base64_decode(uint8_t *out_data, uint32_t size, const uint8_t *base64, uint32_t length) __attribute__((alias ("lBase64Decode")));
 int32_t base64_decode_buffer_required(const uint8_t *base64, uint32_t length) __attribute__((alias ("lBase64DecodeBufferRequired")));
+
+void base64_context_init(base64_context_t *context) __attribute__((alias ("vBase64ContextInit")));
+int32_t base64_encode_update(base64_context_t *context, fifo_t *fifo, const uint8_t *data, uint32_t length) __attribute__((alias ("lBase64EncodeUpdate")));
+int32_t base64_encode_final(base64_context_t *context, fifo_t *fifo) __attribute__((alias ("lBase64EncodeFinal")));
+int32_t base64_decode_update(base64_context_t *context, fifo_t *fifo, const uint8_t *base64, uint32_t length) __attribute__((alias ("lBase64DecodeUpdate")));
+int32_t base64_decode_final(base64_context_t *context) __attribute__((alias ("lBase64DecodeFinal")));
@@ -46,23 +46,91 @@ static uint32_t _ulAsciiToUtf8(uint8_t ucAscii, uint8_t *pulOutUtf) {
   return 4;
 }
 
+static inline uint32_t _ulUtf8Length(uint8_t ucAscii) {
+  uint32_t c = _pusCyrillicUtf[ucAscii];
+  return (c < 0x80)? 1: (c < 0x800)? 2: (c < 0x10000)? 3: 4;
+}
+
+#ifdef CL_SIMD_X86
+
+/* Return count of leading 7-bit bytes, byte sign bits are the mask */
+CL_SIMD_TARGET("avx2")
+static uint32_t _ulAsciiRunAvx2(const uint8_t *pucStr, uint32_t ulLen) {
+  uint32_t i = 0;
+  for (; i + 32 <= ulLen; i += 32) {
+    uint32_t mask = __builtin_ia32_pmovmskb256(*(const ClVec32u_t *)(pucStr + i));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+CL_SIMD_TARGET("sse2")
+static uint32_t _ulAsciiRunSse2(const uint8_t *pucStr, uint32_t ulLen) {
+  uint32_t i = 0;
+  for (; i + 16 <= ulLen; i += 16) {
+    uint32_t mask = __builtin_ia32_pmovmskb128(*(const ClVec16u_t *)(pucStr + i));
+    if (mask) return i + __builtin_ctz(mask);
+  }
+  return i;
+}
+
+#endif /* CL_SIMD_X86 */
+
+typedef uint32_t _CharsetWord_t __attribute__((aligned(1), may_alias));
+
+/* Length of leading run which is the same in CP1251 and UTF-8 */
+static uint32_t _ulAsciiRun(const uint8_t *pucStr, uint32_t ulLen) {
+  uint32_t i = 0;
+#ifdef CL_SIMD_X86
+  if (ulLen >= 16) {
+    uint32_t features = ulClCpuFeatures();
+    if (features & CL_CPU_AVX2) i = _ulAsciiRunAvx2(pucStr, ulLen);
+    if ((features & CL_CPU_SSE2) && (ulLen - i >= 16) && !(pucStr[i] & 0x80)) i += _ulAsciiRunSse2(pucStr + i, ulLen - i);
+  }
+#endif
+  for (; (i + 4 <= ulLen) && !(*(const _CharsetWord_t *)(pucStr + i) & 0x80808080); i += 4);
+  for (; (i < ulLen) && !(pucStr[i] & 0x80); i++);
+  return i;
+}
+
 uint32_t ulAsciiToUtf8Mesure(const uint8_t *pucAsciiStr, uint32_t ulLen) {
   uint32_t length = 0;
-  uint32_t dummy;
-  for(uint32_t i = 0; i < ulLen; i++) length += _ulAsciiToUtf8(pucAsciiStr[i], (uint8_t *)&dummy);
+  uint32_t i = 0;
+  while (i < ulLen) {
+    uint32_t run = _ulAsciiRun(&pucAsciiStr[i], ulLen - i);
+    i += run;
+    length += run;
+    if (i < ulLen) length += _ulUtf8Length(pucAsciiStr[i++]);
+  }
   return length;
 }
 
-uint32_t ulAsciiToUtf8(const uint8_t *pucAsciiStr, uint32_t lLen, uint8_t *pucUtf8Str) {
-  if((lLen == 0) || (pucUtf8Str == libNULL)) return 0;
+uint32_t ulAsciiToUtf8Bounded(const uint8_t *pucAsciiStr, uint32_t ulLen, uint8_t *pucUtf8Str, uint32_t ulSize, uint32_t *pulConverted) {
   uint32_t length = 0;
-  for(uint32_t i = 0; i < lLen; i++) length += _ulAsciiToUtf8(pucAsciiStr[i], &pucUtf8Str[length]);
+  uint32_t i = 0;
+  if (pucUtf8Str != libNULL) {
+    while (i < ulLen) {
+      uint32_t run = _ulAsciiRun(&pucAsciiStr[i], CL_MIN(ulLen - i, ulSize - length));
+      mem_cpy(&pucUtf8Str[length], &pucAsciiStr[i], run);
+      i += run;
+      length += run;
+      if ((i == ulLen) || (length + _ulUtf8Length(pucAsciiStr[i]) > ulSize)) break;
+      length += _ulAsciiToUtf8(pucAsciiStr[i++], &pucUtf8Str[length]);
+    }
+  }
+  if (pulConverted != libNULL) *pulConverted = i;
   return length;
 }
 
+uint32_t ulAsciiToUtf8(const uint8_t *pucAsciiStr, uint32_t lLen, uint8_t *pucUtf8Str) {
+  if((lLen == 0) || (pucUtf8Str == libNULL)) return 0;
+  return ulAsciiToUtf8Bounded(pucAsciiStr, lLen, pucUtf8Str, 0xFFFFFFFF, libNULL);
+}
+
 /*!
   Snake notation
 */
 
 uint32_t ascii_to_utf8(const uint8_t *ascii_str, uint32_t len, uint8_t *utf8_str) __attribute__ ((alias ("ulAsciiToUtf8")));
 uint32_t ascii_to_utf8_mesure(const uint8_t *ascii_str, uint32_t len) __attribute__ ((alias ("ulAsciiToUtf8Mesure")));
+uint32_t ascii_to_utf8_bounded(const uint8_t *ascii_str, uint32_t len, uint8_t *utf8_str, uint32_t size, uint32_t *converted) __attribute__ ((alias ("ulAsciiToUtf8Bounded")));
@@ -1,12 +1,127 @@
 #include "CodeLib.h"
 
+/* Upper case pairs, setting bit 0x20 turns letters to lower case and keeps digits */
+#define _HEX_DIGIT(n)           ((n) < 10? '0' + (n): 'A' - 10 + (n))
+#define _HEX_PAIR(b)            {_HEX_DIGIT((b) >> 4), _HEX_DIGIT((b) & 0x0F)}
+#define _HEX_PAIRS_ROW(h)       _HEX_PAIR(h + 0x0), _HEX_PAIR(h + 0x1), _HEX_PAIR(h + 0x2), _HEX_PAIR(h + 0x3), \
+                                _HEX_PAIR(h + 0x4), _HEX_PAIR(h + 0x5), _HEX_PAIR(h + 0x6), _HEX_PAIR(h + 0x7), \
+                                _HEX_PAIR(h + 0x8), _HEX_PAIR(h + 0x9), _HEX_PAIR(h + 0xA), _HEX_PAIR(h + 0xB), \
+                                _HEX_PAIR(h + 0xC), _HEX_PAIR(h + 0xD), _HEX_PAIR(h + 0xE), _HEX_PAIR(h + 0xF)
+#define _HEX_CASE(bUpper)       ((bUpper)? 0x00: 0x20)
+
+static const uint8_t _aaucHexPairs[256][2] = {
+	_HEX_PAIRS_ROW(0x00), _HEX_PAIRS_ROW(0x10), _HEX_PAIRS_ROW(0x20), _HEX_PAIRS_ROW(0x30),
+	_HEX_PAIRS_ROW(0x40), _HEX_PAIRS_ROW(0x50), _HEX_PAIRS_ROW(0x60), _HEX_PAIRS_ROW(0x70),
+	_HEX_PAIRS_ROW(0x80), _HEX_PAIRS_ROW(0x90), _HEX_PAIRS_ROW(0xA0), _HEX_PAIRS_ROW(0xB0),
+	_HEX_PAIRS_ROW(0xC0), _HEX_PAIRS_ROW(0xD0), _HEX_PAIRS_ROW(0xE0), _HEX_PAIRS_ROW(0xF0)
+};
+
+/* Nibble value of char, 0xFF if char is not hex digit */
+#define _HEX_NIBBLE(c)          (IS_HEX(c)? CHAR_TO_HEX(c): 0xFF)
+#define _HEX_NIBBLES_ROW(h)     _HEX_NIBBLE(h + 0x0), _HEX_NIBBLE(h + 0x1), _HEX_NIBBLE(h + 0x2), _HEX_NIBBLE(h + 0x3), \
+                                _HEX_NIBBLE(h + 0x4), _HEX_NIBBLE(h + 0x5), _HEX_NIBBLE(h + 0x6), _HEX_NIBBLE(h + 0x7), \
+                                _HEX_NIBBLE(h + 0x8), _HEX_NIBBLE(h + 0x9), _HEX_NIBBLE(h + 0xA), _HEX_NIBBLE(h + 0xB), \
+                                _HEX_NIBBLE(h + 0xC), _HEX_NIBBLE(h + 0xD), _HEX_NIBBLE(h + 0xE), _HEX_NIBBLE(h + 0xF)
+
+static const uint8_t _aucHexNibbles[256] = {
+	_HEX_NIBBLES_ROW(0x00), _HEX_NIBBLES_ROW(0x10), _HEX_NIBBLES_ROW(0x20), _HEX_NIBBLES_ROW(0x30),
+	_HEX_NIBBLES_ROW(0x40), _HEX_NIBBLES_ROW(0x50), _HEX_NIBBLES_ROW(0x60), _HEX_NIBBLES_ROW(0x70),
+	_HEX_NIBBLES_ROW(0x80), _HEX_NIBBLES_ROW(0x90), _HEX_NIBBLES_ROW(0xA0), _HEX_NIBBLES_ROW(0xB0),
+	_HEX_NIBBLES_ROW(0xC0), _HEX_NIBBLES_ROW(0xD0), _HEX_NIBBLES_ROW(0xE0), _HEX_NIBBLES_ROW(0xF0)
+};
+
+#ifdef CL_SIMD_X86
+
+typedef unsigned char _HexVecU16_t __attribute__((vector_size(16)));
+typedef short _HexVec8s_t __attribute__((vector_size(16)));
+
+/* 16 bytes to 32 chars per step */
+CL_SIMD_TARGET("ssse3")
+static uint32_t _ulHexEncodeSsse3(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength, uint8_t bToUpperCase) {
+	const ClVec16_t digits = (ClVec16_t){'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'} | (char)_HEX_CASE(bToUpperCase);
+	/* Every byte is doubled, high nibble goes to even position */
+	const ClVec16_t even = {-1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0};
+	uint32_t i = 0;
+	for (; i + 16 <= ulLength; i += 16, pucDst += 32) {
+		ClVec16_t in = *(const ClVec16u_t *)(pucSrc + i);
+		ClVec16_t lo = __builtin_ia32_pshufb128(in, (ClVec16_t){0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7});
+		ClVec16_t hi = __builtin_ia32_pshufb128(in, (ClVec16_t){8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15});
+		lo = (((ClVec16_t)((_HexVec8s_t)lo >> 4) & even) | (lo & ~even)) & 0x0F;
+		hi = (((ClVec16_t)((_HexVec8s_t)hi >> 4) & even) | (hi & ~even)) & 0x0F;
+		*(ClVec16u_t *)pucDst = __builtin_ia32_pshufb128(digits, lo);
+		*(ClVec16u_t *)(pucDst + 16) = __builtin_ia32_pshufb128(digits, hi);
+	}
+	return i;
+}
+
+/* Chars to nibbles, lanes of invalid chars are set in pxInvalid */
+CL_SIMD_TARGET("ssse3")
+static inline ClVec16_t _xHexNibblesSsse3(ClVec16_t xIn, ClVec16_t *pxInvalid) {
+	_HexVecU16_t digit = (_HexVecU16_t)xIn - '0';
+	_HexVecU16_t alpha = ((_HexVecU16_t)xIn | 0x20) - 'a';
+	ClVec16_t isDigit = (ClVec16_t)(digit < 10);
+	ClVec16_t isAlpha = (ClVec16_t)(alpha < 6);
+	*pxInvalid |= ~(isDigit | isAlpha);
+	return ((ClVec16_t)digit & isDigit) | ((ClVec16_t)(alpha + 10) & isAlpha);
+}
+
+/* 32 chars to 16 bytes per step, block with invalid char is left to scalar code */
+CL_SIMD_TARGET("ssse3")
+static uint32_t _ulHexDecodeSsse3(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength) {
+	const ClVec16_t weights = {16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1};
+	uint32_t i = 0;
+	for (; i + 32 <= ulLength; i += 32, pucDst += 16) {
+		ClVec16_t invalid = {0};
+		ClVec16_t a = _xHexNibblesSsse3(*(const ClVec16u_t *)(pucSrc + i), &invalid);
+		ClVec16_t b = _xHexNibblesSsse3(*(const ClVec16u_t *)(pucSrc + i + 16), &invalid);
+		if (__builtin_ia32_pmovmskb128(invalid))
+			break;
+		a = (ClVec16_t)__builtin_ia32_pmaddubsw128(a, weights);
+		b = (ClVec16_t)__builtin_ia32_pmaddubsw128(b, weights);
+		*(ClVec16u_t *)pucDst = __builtin_ia32_pshufb128(a, (ClVec16_t){0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1}) |
+		                        __builtin_ia32_pshufb128(b, (ClVec16_t){-1, -1, -1, -1, -1, -1, -1, -1, 0, 2, 4, 6, 8, 10, 12, 14});
+	}
+	return i;
+}
+
+#endif /* CL_SIMD_X86 */
+
 uint16_t usConvertByteToAsciiHex(uint8_t ucVal, uint8_t bToUpperCase) {
-	uint16_t ucHigh = (ucVal >> 4);	
-	uint16_t ucLow = (ucVal & 0x0F);
-  uint8_t base = (bToUpperCase? 'A': 'a');
-	ucHigh = (ucHigh > 9) ? (ucHigh - 10 + base) : ucHigh + '0';
-	ucLow = (ucLow > 9) ? (ucLow - 10 + base) : ucLow + '0';
-	return ((ucHigh << 8) | ucLow);
+	return (((_aaucHexPairs[ucVal][0] << 8) | _aaucHexPairs[ucVal][1]) | (_HEX_CASE(bToUpperCase) * 0x0101));
+}
+
+int32_t lHexEncode(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength, uint8_t bToUpperCase) {
+	if ((pucDst == libNULL) || ((pucSrc == libNULL) && ulLength)) return -1;
+	uint8_t lower = _HEX_CASE(bToUpperCase);
+	uint32_t i = 0;
+#ifdef CL_SIMD_X86
+	if ((ulLength >= 16) && (ulClCpuFeatures() & CL_CPU_SSSE3)) {
+		i = _ulHexEncodeSsse3(pucDst, pucSrc, ulLength, bToUpperCase);
+	}
+#endif
+	for (; i < ulLength; i++) {
+		pucDst[i * 2] = _aaucHexPairs[pucSrc[i]][0] | lower;
+		pucDst[i * 2 + 1] = _aaucHexPairs[pucSrc[i]][1] | lower;
+	}
+	return ulLength * 2;
+}
+
+int32_t lHexDecode(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength) {
+	if ((pucDst == libNULL) || ((pucSrc == libNULL) && ulLength)) return -1;
+	uint32_t i = 0;
+#ifdef CL_SIMD_X86
+	if ((ulLength >= 32) && (ulClCpuFeatures() & CL_CPU_SSSE3)) {
+		i = _ulHexDecodeSsse3(pucDst, pucSrc, ulLength);
+	}
+#endif
+	for (; i + 2 <= ulLength; i += 2) {
+		uint8_t high = _aucHexNibbles[pucSrc[i]];
+		uint8_t low = _aucHexNibbles[pucSrc[i + 1]];
+		if ((high | low) & 0xF0) return -2 - (int32_t)((high & 0xF0)? i: i + 1);
+		pucDst[i >> 1] = (high << 4) | low;
+	}
+	if (ulLength & 1) return -2 - (int32_t)i;
+	return ulLength >> 1;
 }
 
 uint8_t bConvertAsciiHexToByte(uint16_t usTwoAscii, uint8_t *ucOutByte) {
@@ -26,4 +141,6 @@ uint8_t bConvertAsciiHexToByte(uint16_t usTwoAscii, uint8_t *ucOutByte) {
 */
 
 uint16_t convert_byte_to_ascii_hex(uint8_t val, uint8_t to_upper_case) __attribute__ ((alias ("usConvertByteToAsciiHex")));
-uint8_t convert_ascii_hex_to_byte(uint16_t two_ascii, uint8_t *out_byte) __attribute__ ((alias ("bConvertAsciiHexToByte")));
\ No newline at end of file
+uint8_t convert_ascii_hex_to_byte(uint16_t two_ascii, uint8_t *out_byte) __attribute__ ((alias ("bConvertAsciiHexToByte")));
+int32_t hex_encode(uint8_t *dst, const uint8_t *src, uint32_t length, uint8_t to_upper_case) __attribute__ ((alias ("lHexEncode")));
+int32_t hex_decode(uint8_t *dst, const uint8_t *src, uint32_t length) __attribute__ ((alias ("lHexDecode")));
\ No newline at end of file
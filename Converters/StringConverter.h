@@ -8,12 +8,37 @@ extern "C" {
 uint16_t usConvertByteToAsciiHex(uint8_t ucVal, uint8_t bToUpperCase);
 uint8_t bConvertAsciiHexToByte(uint16_t usTwoAscii, uint8_t *ucOutByte);
 
+/* Position of invalid char from negative lHexDecode result */
+#define HEX_DECODE_ERROR_POSITION(lResult)    ((uint32_t)(-2 - (lResult)))
+
+/*!
+  @brief Encode data to hex chars, two per byte
+  @param[out] pucDst         Output buffer, 2 * ulLength size
+  @param[in] pucSrc          Data
+  @param[in] ulLength        Data length
+  @param[in] bToUpperCase    Use upper case letters
+  @return Written chars count, <0 if error
+*/
+int32_t lHexEncode(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength, uint8_t bToUpperCase);
+
+/*!
+  @brief Decode hex chars, both letter cases are accepted
+  @param[out] pucDst         Output buffer, ulLength / 2 size
+  @param[in] pucSrc          Hex chars
+  @param[in] ulLength        Chars count
+  @return Decoded bytes count, -1 for bad arguments, less than -1 if input is invalid,
+          HEX_DECODE_ERROR_POSITION() of it gives index of invalid char or of last char if length is odd
+*/
+int32_t lHexDecode(uint8_t *pucDst, const uint8_t *pucSrc, uint32_t ulLength);
+
 /*!
   Snake notation
 */
 
 uint16_t convert_byte_to_ascii_hex(uint8_t val, uint8_t to_upper_case);
 uint8_t convert_ascii_hex_to_byte(uint16_t two_ascii, uint8_t *out_byte);
+int32_t hex_encode(uint8_t *dst, const uint8_t *src, uint32_t length, uint8_t to_upper_case);
+int32_t hex_decode(uint8_t *dst, const uint8_t *src, uint32_t length);
 
 #ifdef __cplusplus
 }
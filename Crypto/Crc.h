@@ -11,32 +11,201 @@ typedef enum {
   CRC32_INVERT_OUT = 4
 } Crc32Options_t;
 
+#define CRC32_TABLE_SLICES 8
+
+/*!
+  Lookup tables of one polynomial for slicing-by-8 processing, 8 KiB
+*/
+typedef struct {
+  uint32_t ulPoly;
+  uint8_t bReflected;
+  uint32_t aulTable[CRC32_TABLE_SLICES][256];
+} Crc32Table_t;
+
+/*!
+  Incremental calculation state, register is kept in processing bit order
+*/
+typedef struct {
+  const Crc32Table_t *pxTable;
+  uint32_t ulCrc;
+  uint32_t ulPoly;
+  Crc32Options_t eOpt;
+} Crc32Context_t;
+
+typedef struct {
+  uint16_t usCrc;
+} Crc16Context_t;
+
+typedef struct {
+  uint8_t ucCrc;
+} Crc8Context_t;
+
 uint8_t ucCrc8Dallas(const uint8_t *pucData, uint32_t ulLen, const uint8_t *pucCrc);
 uint16_t usCrc16ModbusRtu(const uint8_t *pucData, uint16_t usLen, const uint16_t *pusCrc);
+
+/*!
+  @brief Calculate CRC32 with any parameters, nibble table is built per call, no tables memory needed
+  @param[in] pvData     Data pointer
+  @param[in] ulLen      Data length
+  @param[in] ulInit     Initial register value
+  @param[in] ulPoly     Polynomial, normal form
+  @param[in] eOpt       Crc32Options_t flags
+  @return CRC32 value
+*/
 uint32_t ulCrc32(const void *pvData, uint32_t ulLen, uint32_t ulInit, const uint32_t ulPoly, Crc32Options_t eOpt);
 
-#define CRC_32_AIXM(data, len) ulCrc32(data, len, 0x00000000, 0x814141AB, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
-#define CRC_32_AUTOSAR(data, len) ulCrc32_n(data, len, 0xFFFFFFFF, 0xF4ACFB13, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_BASE91_D(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0xA833982B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_BZIP2(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_CD_ROM_EDC(data, len) ulCrc32(data, len, 0x00000000, 0x8001801B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
-#define CRC_32_CKSUM(data, len) ulCrc32(data, len, 0x00000000, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_ISCSI(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x1EDC6F41, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_ISO_HDLC(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT);
-#define CRC_32_JAMCRC(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
-#define CRC_32_MEF(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x741B8CD7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
-#define CRC_32_MPEG_2(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
-#define CRC_32_XFER(data, len) ulCrc32(data, len, 0x00000000, 0x000000AF, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT);
+/*!
+  @brief Build lookup tables for ulCrc32Table
+  @param[in] pxTable    Tables to fill
+  @param[in] ulPoly     Polynomial, normal form
+  @param[in] eOpt       Only CRC32_REFLECT_IN is used, the rest of options are passed to ulCrc32Table
+*/
+void vCrc32TableInit(Crc32Table_t *pxTable, uint32_t ulPoly, Crc32Options_t eOpt);
+
+/*!
+  @brief Calculate CRC32 with lookup tables, slicing-by-8 for long buffers. Results match ulCrc32
+  @param[in] pxTable    Tables built by vCrc32TableInit
+  @param[in] pvData     Data pointer
+  @param[in] ulLen      Data length
+  @param[in] ulInit     Initial register value
+  @param[in] eOpt       Crc32Options_t flags, CRC32_REFLECT_IN is taken from tables
+  @return CRC32 value
+*/
+uint32_t ulCrc32Table(const Crc32Table_t *pxTable, const void *pvData, uint32_t ulLen, uint32_t ulInit, Crc32Options_t eOpt);
+
+/*!
+  @brief Start incremental CRC32 calculation
+  @param[in] pxCtx      Context
+  @param[in] ulInit     Initial register value
+  @param[in] ulPoly     Polynomial, normal form, ignored if tables given
+  @param[in] eOpt       Crc32Options_t flags, CRC32_REFLECT_IN is taken from tables if given
+  @param[in] pxTable    Tables built by vCrc32TableInit or libNULL to use no tables
+*/
+void vCrc32Init(Crc32Context_t *pxCtx, uint32_t ulInit, uint32_t ulPoly, Crc32Options_t eOpt, const Crc32Table_t *pxTable);
+
+/*!
+  @brief Feed data chunk to incremental CRC32 calculation
+  @param[in] pxCtx      Context
+  @param[in] pvData     Data pointer
+  @param[in] ulLen      Data length
+*/
+void vCrc32Update(Crc32Context_t *pxCtx, const void *pvData, uint32_t ulLen);
+
+/*!
+  @brief Get CRC32 of data fed so far, context stays valid for further updates
+  @param[in] pxCtx      Context
+  @return CRC32 value
+*/
+uint32_t ulCrc32Final(const Crc32Context_t *pxCtx);
+
+/*!
+  @brief Get CRC32 of concatenated blocks A and B from CRC32 values of the blocks
+  @param[in] ulCrcA     CRC32 of block A
+  @param[in] ulCrcB     CRC32 of block B
+  @param[in] ulLenB     Length of block B
+  @param[in] ulInit     Initial register value both blocks calculated with
+  @param[in] ulPoly     Polynomial, normal form
+  @param[in] eOpt       Crc32Options_t flags
+  @return CRC32 of A followed by B
+*/
+uint32_t ulCrc32Combine(uint32_t ulCrcA, uint32_t ulCrcB, uint32_t ulLenB, uint32_t ulInit, uint32_t ulPoly, Crc32Options_t eOpt);
+
+#ifndef CRC32_PARALLEL_MAX_SLICES
+#define CRC32_PARALLEL_MAX_SLICES 32
+#endif
+
+/* Shorter slices are not worth the threads */
+#ifndef CRC32_PARALLEL_MIN_SLICE
+#define CRC32_PARALLEL_MIN_SLICE 65536
+#endif
+
+/*!
+  @brief Platform executor: run pfJob(ppvArgs[i]) for all ulCount args concurrently, return when all jobs done
+*/
+typedef void (*CrcRunJobs_t)(void (*pfJob)(void *pvArg), void **ppvArgs, uint32_t ulCount, void *pvCtx);
+
+/*!
+  @brief Calculate CRC32 of data slices concurrently and combine them, result matches ulCrc32
+  @param[in] pvData     Data pointer
+  @param[in] ulLen      Data length
+  @param[in] ulThreads  Desired slices count, limited by CRC32_PARALLEL_MAX_SLICES and CRC32_PARALLEL_MIN_SLICE
+  @param[in] ulInit     Initial register value
+  @param[in] ulPoly     Polynomial, normal form, ignored if tables given
+  @param[in] eOpt       Crc32Options_t flags, CRC32_REFLECT_IN is taken from tables if given
+  @param[in] pxTable    Tables built by vCrc32TableInit or libNULL to use no tables
+  @param[in] pfRun      Executor, calculation runs in calling thread if libNULL
+  @param[in] pvRunCtx   Executor context
+  @return CRC32 value
+*/
+uint32_t ulCrc32Parallel(const void *pvData, uint32_t ulLen, uint32_t ulThreads, uint32_t ulInit, uint32_t ulPoly,
+                         Crc32Options_t eOpt, const Crc32Table_t *pxTable, CrcRunJobs_t pfRun, void *pvRunCtx);
+
+#ifdef CL_CRC_PTHREADS
+/*!
+  @brief CrcRunJobs_t executor with POSIX threads, calling thread runs the first job
+         and jobs beyond CRC32_PARALLEL_MAX_SLICES threads, all jobs are done on return
+*/
+void vCrcRunPthreads(void (*pfJob)(void *pvArg), void **ppvArgs, uint32_t ulCount, void *pvCtx);
+#endif
+
+/*!
+  @brief Incremental CRC16 Modbus RTU calculation, init, update with data chunks, get result
+*/
+void vCrc16ModbusRtuInit(Crc16Context_t *pxCtx);
+void vCrc16ModbusRtuUpdate(Crc16Context_t *pxCtx, const uint8_t *pucData, uint32_t ulLen);
+uint16_t usCrc16ModbusRtuFinal(const Crc16Context_t *pxCtx);
+
+/*!
+  @brief Incremental CRC8 Dallas calculation, init, update with data chunks, get result
+*/
+void vCrc8DallasInit(Crc8Context_t *pxCtx);
+void vCrc8DallasUpdate(Crc8Context_t *pxCtx, const uint8_t *pucData, uint32_t ulLen);
+uint8_t ucCrc8DallasFinal(const Crc8Context_t *pxCtx);
+
+#define CRC_32_AIXM(data, len) ulCrc32(data, len, 0x00000000, 0x814141AB, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
+#define CRC_32_AUTOSAR(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0xF4ACFB13, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_BASE91_D(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0xA833982B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_BZIP2(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_CD_ROM_EDC(data, len) ulCrc32(data, len, 0x00000000, 0x8001801B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
+#define CRC_32_CKSUM(data, len) ulCrc32(data, len, 0x00000000, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_ISCSI(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x1EDC6F41, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_ISO_HDLC(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_32_JAMCRC(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
+#define CRC_32_MEF(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x741B8CD7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
+#define CRC_32_MPEG_2(data, len) ulCrc32(data, len, 0xFFFFFFFF, 0x04C11DB7, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
+#define CRC_32_XFER(data, len) ulCrc32(data, len, 0x00000000, 0x000000AF, !CRC32_REFLECT_IN | !CRC32_REFLECT_OUT | !CRC32_INVERT_OUT)
 
 /*!
   Snake notation
 */
 
 typedef Crc32Options_t crc32_options_t;
+typedef Crc32Table_t crc32_table_t;
+typedef Crc32Context_t crc32_context_t;
+typedef Crc16Context_t crc16_context_t;
+typedef Crc8Context_t crc8_context_t;
+typedef CrcRunJobs_t crc_run_jobs_t;
 
 uint32_t crc32(const void *data, uint32_t len, uint32_t init, const uint32_t poly, crc32_options_t opt);
+void crc32_table_init(crc32_table_t *table, uint32_t poly, crc32_options_t opt);
+uint32_t crc32_table(const crc32_table_t *table, const void *data, uint32_t len, uint32_t init, crc32_options_t opt);
+void crc32_init(crc32_context_t *ctx, uint32_t init, uint32_t poly, crc32_options_t opt, const crc32_table_t *table);
+void crc32_update(crc32_context_t *ctx, const void *data, uint32_t len);
+uint32_t crc32_final(const crc32_context_t *ctx);
+uint32_t crc32_combine(uint32_t crc_a, uint32_t crc_b, uint32_t len_b, uint32_t init, uint32_t poly, crc32_options_t opt);
+uint32_t crc32_parallel(const void *data, uint32_t len, uint32_t threads, uint32_t init, uint32_t poly,
+                        crc32_options_t opt, const crc32_table_t *table, crc_run_jobs_t run, void *run_ctx);
+#ifdef CL_CRC_PTHREADS
+void crc_run_pthreads(void (*job)(void *arg), void **args, uint32_t count, void *ctx);
+#endif
 uint16_t crc16_modbus_rtu(const uint8_t *data, uint16_t len, const uint16_t *crc);
+void crc16_modbus_rtu_init(crc16_context_t *ctx);
+void crc16_modbus_rtu_update(crc16_context_t *ctx, const uint8_t *data, uint32_t len);
+uint16_t crc16_modbus_rtu_final(const crc16_context_t *ctx);
 uint8_t crc8_dallas(const uint8_t *data, uint32_t len, const uint8_t *crc);
+void crc8_dallas_init(crc8_context_t *ctx);
+void crc8_dallas_update(crc8_context_t *ctx, const uint8_t *data, uint32_t len);
+uint8_t crc8_dallas_final(const crc8_context_t *ctx);
 
 #ifdef __cplusplus
 }
@@ -5,10 +5,37 @@
 extern "C" {
 #endif
 
+/*!
+  XXH64 streaming state
+*/
+typedef struct {
+  uint64_t aullAcc[4];
+  uint64_t ullSeed;
+  uint64_t ullTotalSize;
+  uint8_t aucBuffer[32];
+  uint32_t ulBufferedSize;
+} HashXxh64Context_t;
+
 uint32_t HashDjb2 (void *pxData, uint32_t ulSize);
 uint32_t HashSdbm (void *pxData, uint32_t ulSize);
 uint32_t HashKnuth (void *pxData, uint32_t ulSize);
 
+/*!
+  @brief 64-bit xxHash (XXH64), processes 32 bytes per step, compatible with reference implementation
+  @param[in] pxData     Data pointer
+  @param[in] ulSize     Data size
+  @param[in] ullSeed    Seed
+  @return Hash value
+*/
+uint64_t HashXxh64 (const void *pxData, uint32_t ulSize, uint64_t ullSeed);
+
+/*!
+  @brief XXH64 streaming: init with seed, update with data chunks, get hash of data fed so far
+*/
+void HashXxh64Init (HashXxh64Context_t *pxCtx, uint64_t ullSeed);
+void HashXxh64Update (HashXxh64Context_t *pxCtx, const void *pxData, uint32_t ulSize);
+uint64_t HashXxh64Final (const HashXxh64Context_t *pxCtx);
+
 /*!
   Snake notation
 */
@@ -17,6 +44,13 @@ uint32_t hash_dbj2 (void *data, uint32_t size);
 uint32_t hash_sdbm (void *data, uint32_t size);
 uint32_t hash_knuth (void *data, uint32_t size);
 
+typedef HashXxh64Context_t hash_xxh64_context_t;
+
+uint64_t hash_xxh64 (const void *data, uint32_t size, uint64_t seed);
+void hash_xxh64_init (hash_xxh64_context_t *ctx, uint64_t seed);
+void hash_xxh64_update (hash_xxh64_context_t *ctx, const void *data, uint32_t size);
+uint64_t hash_xxh64_final (const hash_xxh64_context_t *ctx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,44 +1,662 @@
 #include "CodeLib.h"
 
+/*
+  Reflected input is processed LSB first in reflected register with reflected polynomial,
+  equal to MSB first processing of reflected bytes, register is reflected back at the end.
+ */
+
+static uint32_t _ulCrc32Out(uint32_t ulCrc, uint8_t bReflectedReg, Crc32Options_t eOpt) {
+	if (bReflectedReg != ((eOpt & CRC32_REFLECT_OUT) != 0)) ulCrc = ulBitReflect(ulCrc, 32);
+	if (eOpt & CRC32_INVERT_OUT) ulCrc = ~ulCrc;
+	return ulCrc;
+}
+
+#ifdef CL_SIMD_X86
+
+#define _CRC32_POLY_ISO_HDLC                0x04C11DB7
+#define _CRC32_POLY_ISCSI                   0x1EDC6F41
+/* Shorter buffers are not worth kernels setup */
+#define _CRC32_HW_THRESHOLD                 64
+
+typedef long long _Crc32V2di_t __attribute__((vector_size(16)));
+typedef int _Crc32V4si_t __attribute__((vector_size(16)));
+typedef long long _Crc32V2diU_t __attribute__((vector_size(16), aligned(1), may_alias));
+typedef uint32_t __attribute__((may_alias, aligned(1))) _Crc32UWord_t;
+#ifdef __x86_64__
+typedef uint64_t __attribute__((may_alias, aligned(1))) _Crc32UDWord_t;
+#endif
+
+/* CRC-32C with SSE4.2 crc32 instruction, it updates reflected register */
+CL_SIMD_TARGET("sse4.2")
+static uint32_t _ulCrc32cSse42(uint32_t *pulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	uint32_t crc = *pulCrc;
+	uint32_t i = 0;
+#ifdef __x86_64__
+	uint64_t crc64 = crc;
+	for (; i + 32 <= ulLen; i += 32) {
+		crc64 = __builtin_ia32_crc32di(crc64, *(const _Crc32UDWord_t *)(pucData + i));
+		crc64 = __builtin_ia32_crc32di(crc64, *(const _Crc32UDWord_t *)(pucData + i + 8));
+		crc64 = __builtin_ia32_crc32di(crc64, *(const _Crc32UDWord_t *)(pucData + i + 16));
+		crc64 = __builtin_ia32_crc32di(crc64, *(const _Crc32UDWord_t *)(pucData + i + 24));
+	}
+	crc = (uint32_t)crc64;
+#endif
+	for (; i + 4 <= ulLen; i += 4) {
+		crc = __builtin_ia32_crc32si(crc, *(const _Crc32UWord_t *)(pucData + i));
+	}
+	*pulCrc = crc;
+	return i;
+}
+
+/*
+  CRC-32/ISO-HDLC folding with carry-less multiplication, processes multiple of 16 bytes, at least 64.
+  "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", Intel, 2009,
+  bit-reflected domain constants.
+ */
+CL_SIMD_TARGET("pclmul,sse4.1")
+static uint32_t _ulCrc32IsoHdlcPclmul(uint32_t *pulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	const _Crc32V2di_t k1k2 = { 0x0154442bd4, 0x01c6e41596 };
+	const _Crc32V2di_t k3k4 = { 0x01751997d0, 0x00ccaa009e };
+	const _Crc32V2di_t k5k0 = { 0x0163cd6124, 0x0000000000 };
+	const _Crc32V2di_t poly = { 0x01db710641, 0x01f7011641 };
+	const _Crc32V2di_t mask32 = (_Crc32V2di_t)(_Crc32V4si_t){ ~0, 0, ~0, 0 };
+	uint32_t len = ulLen & ~15UL;
+	const uint8_t *buf = pucData;
+	_Crc32V2di_t x0, x1, x2, x3, x4, x5, x6, x7, x8;
+	x1 = *(const _Crc32V2diU_t *)(buf + 0x00);
+	x2 = *(const _Crc32V2diU_t *)(buf + 0x10);
+	x3 = *(const _Crc32V2diU_t *)(buf + 0x20);
+	x4 = *(const _Crc32V2diU_t *)(buf + 0x30);
+	x1 ^= (_Crc32V2di_t)(_Crc32V4si_t){ (int)*pulCrc, 0, 0, 0 };
+	x0 = k1k2;
+	buf += 64;
+	len -= 64;
+	/* Fold 4 blocks in parallel */
+	while (len >= 64) {
+		x5 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+		x6 = __builtin_ia32_pclmulqdq128(x2, x0, 0x00);
+		x7 = __builtin_ia32_pclmulqdq128(x3, x0, 0x00);
+		x8 = __builtin_ia32_pclmulqdq128(x4, x0, 0x00);
+		x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x11);
+		x2 = __builtin_ia32_pclmulqdq128(x2, x0, 0x11);
+		x3 = __builtin_ia32_pclmulqdq128(x3, x0, 0x11);
+		x4 = __builtin_ia32_pclmulqdq128(x4, x0, 0x11);
+		x1 ^= x5 ^ *(const _Crc32V2diU_t *)(buf + 0x00);
+		x2 ^= x6 ^ *(const _Crc32V2diU_t *)(buf + 0x10);
+		x3 ^= x7 ^ *(const _Crc32V2diU_t *)(buf + 0x20);
+		x4 ^= x8 ^ *(const _Crc32V2diU_t *)(buf + 0x30);
+		buf += 64;
+		len -= 64;
+	}
+	/* Fold into 128 bits */
+	x0 = k3k4;
+	x5 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+	x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x11);
+	x1 ^= x2 ^ x5;
+	x5 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+	x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x11);
+	x1 ^= x3 ^ x5;
+	x5 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+	x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x11);
+	x1 ^= x4 ^ x5;
+	/* Fold the rest of 16 bytes blocks */
+	while (len >= 16) {
+		x5 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+		x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x11);
+		x1 ^= x5 ^ *(const _Crc32V2diU_t *)buf;
+		buf += 16;
+		len -= 16;
+	}
+	/* Fold 128 bits to 64 bits */
+	x2 = __builtin_ia32_pclmulqdq128(x1, x0, 0x10);
+	x1 = (_Crc32V2di_t){ x1[1], 0 };
+	x1 ^= x2;
+	x0 = k5k0;
+	_Crc32V4si_t w = (_Crc32V4si_t)x1;
+	x2 = (_Crc32V2di_t)(_Crc32V4si_t){ w[1], w[2], w[3], 0 };
+	x1 &= mask32;
+	x1 = __builtin_ia32_pclmulqdq128(x1, x0, 0x00);
+	x1 ^= x2;
+	/* Barrett reduction to 32 bits */
+	x0 = poly;
+	x2 = x1 & mask32;
+	x2 = __builtin_ia32_pclmulqdq128(x2, x0, 0x10);
+	x2 &= mask32;
+	x2 = __builtin_ia32_pclmulqdq128(x2, x0, 0x00);
+	x1 ^= x2;
+	*pulCrc = (uint32_t)((_Crc32V4si_t)x1)[1];
+	return ulLen & ~15UL;
+}
+
+/* Reflected register update with CPU support for known polynomials, return processed bytes count */
+static uint32_t _ulCrc32HwReflected(uint32_t ulPoly, uint32_t *pulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	if (ulLen >= _CRC32_HW_THRESHOLD) {
+		uint32_t features = ulClCpuFeatures();
+		if ((ulPoly == _CRC32_POLY_ISCSI) && (features & CL_CPU_SSE42)) {
+			return _ulCrc32cSse42(pulCrc, pucData, ulLen);
+		}
+		if ((ulPoly == _CRC32_POLY_ISO_HDLC) && (features & CL_CPU_PCLMUL) && (features & CL_CPU_SSE41)) {
+			return _ulCrc32IsoHdlcPclmul(pulCrc, pucData, ulLen);
+		}
+	}
+	return 0;
+}
+
+#endif /* CL_SIMD_X86 */
+
+/* Register update, nibble table is cheap to build per call and needs no static memory */
+static uint32_t _ulCrc32Nibbles(uint32_t ulCrc, uint32_t ulPoly, uint8_t bReflected, const uint8_t *pucData, uint32_t ulLen) {
+	uint32_t nibbles[16];
+	uint32_t crc;
+	if (bReflected) {
+#ifdef CL_SIMD_X86
+		uint32_t done = _ulCrc32HwReflected(ulPoly, &ulCrc, pucData, ulLen);
+		pucData += done;
+		ulLen -= done;
+#endif
+		uint32_t poly = ulBitReflect(ulPoly, 32);
+		for (uint32_t i = 0; i < 16; i++) {
+			crc = i;
+			for (int bit = 0; bit < 4; bit++) crc = (crc >> 1) ^ ((crc & 1)? poly: 0);
+			nibbles[i] = crc;
+		}
+		while (ulLen--) {
+			ulCrc ^= *pucData++;
+			ulCrc = (ulCrc >> 4) ^ nibbles[ulCrc & 0x0F];
+			ulCrc = (ulCrc >> 4) ^ nibbles[ulCrc & 0x0F];
+		}
+		return ulCrc;
+	}
+	for (uint32_t i = 0; i < 16; i++) {
+		crc = i << 28;
+		for (int bit = 0; bit < 4; bit++) crc = (crc << 1) ^ ((crc & (1UL << 31))? ulPoly: 0);
+		nibbles[i] = crc;
+	}
+	while (ulLen--) {
+		ulCrc ^= (uint32_t)*pucData++ << 24;
+		ulCrc = (ulCrc << 4) ^ nibbles[ulCrc >> 28];
+		ulCrc = (ulCrc << 4) ^ nibbles[ulCrc >> 28];
+	}
+	return ulCrc;
+}
+
 uint32_t ulCrc32(const void *pvData, uint32_t ulLen, uint32_t ulInit, const uint32_t ulPoly, Crc32Options_t eOpt) {
-  const uint8_t *buf = (const uint8_t *)pvData;
-  uint32_t crc = ulInit;
-  while(ulLen--) {
-    uint8_t b = *buf++;
-    if(eOpt & CRC32_REFLECT_IN) b = ulBitReflect(b, 8);
-    crc = crc ^ (b << 24);
-    for( int bit = 0; bit < 8; bit++ ) {
-      if( crc & (1L << 31)) crc = (crc << 1) ^ ulPoly;
-      else                  crc = (crc << 1);
-    }
-  }
-  if(eOpt & CRC32_INVERT_OUT) crc = ~crc;
-  if(eOpt & CRC32_REFLECT_OUT) crc = ulBitReflect(crc, 32);
-  return crc;
-}
-
-static uint16_t _usCrc16ModbusRtuNext(uint16_t pucCrc, uint8_t ucData) {
-	pucCrc ^= (uint16_t)ucData; /* XOR byte into least sig. byte of crc */
-	for (int i = 8; i != 0; i--) { /* Loop over each bit */
-		if ((pucCrc & 0x0001) != 0) { /*If the LSB is set */
-			pucCrc >>= 1; /* Shift right and XOR 0xA001 */
-			pucCrc ^= 0xA001;
+	uint8_t reflected = (eOpt & CRC32_REFLECT_IN) != 0;
+	uint32_t crc = reflected? ulBitReflect(ulInit, 32): ulInit;
+	crc = _ulCrc32Nibbles(crc, ulPoly, reflected, (const uint8_t *)pvData, ulLen);
+	return _ulCrc32Out(crc, reflected, eOpt);
+}
+
+void vCrc32TableInit(Crc32Table_t *pxTable, uint32_t ulPoly, Crc32Options_t eOpt) {
+	uint8_t reflected = (eOpt & CRC32_REFLECT_IN) != 0;
+	uint32_t poly = reflected? ulBitReflect(ulPoly, 32): ulPoly;
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc;
+		if (reflected) {
+			crc = i;
+			for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ ((crc & 1)? poly: 0);
 		}
-		else { /* Else LSB is not set */
-			pucCrc >>= 1; /* Just shift right */
+		else {
+			crc = i << 24;
+			for (int bit = 0; bit < 8; bit++) crc = (crc << 1) ^ ((crc & (1UL << 31))? poly: 0);
+		}
+		pxTable->aulTable[0][i] = crc;
+	}
+	for (uint32_t i = 0; i < 256; i++) {
+		for (int slice = 1; slice < CRC32_TABLE_SLICES; slice++) {
+			uint32_t prev = pxTable->aulTable[slice - 1][i];
+			pxTable->aulTable[slice][i] = reflected? ((prev >> 8) ^ pxTable->aulTable[0][prev & 0xFF]):
+			                                         ((prev << 8) ^ pxTable->aulTable[0][prev >> 24]);
 		}
 	}
-	return pucCrc;
+	pxTable->ulPoly = ulPoly;
+	pxTable->bReflected = reflected;
 }
 
-static uint8_t _ucCrc8DallasNext(uint8_t ucData) {
-	const uint8_t pucCrcBitComp[] = { 0x5e, 0xbc, 0x61, 0xc2, 0x9d, 0x23, 0x46, 0x8c };
-	uint8_t crc = 0;
-	uint8_t i;
-	for (i = 0; i < 8; i++) {
-		crc ^= (ucData & (0x01 << i)) ? pucCrcBitComp[i] : 0;
+static uint32_t _ulCrc32TableReflected(const uint32_t (*T)[256], uint32_t ulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	for (; ulLen >= 8; ulLen -= 8, pucData += 8) {
+		uint32_t one = ulCrc ^ ((uint32_t)pucData[0] | ((uint32_t)pucData[1] << 8) | ((uint32_t)pucData[2] << 16) | ((uint32_t)pucData[3] << 24));
+		uint32_t two = (uint32_t)pucData[4] | ((uint32_t)pucData[5] << 8) | ((uint32_t)pucData[6] << 16) | ((uint32_t)pucData[7] << 24);
+		ulCrc = T[7][one & 0xFF] ^ T[6][(one >> 8) & 0xFF] ^ T[5][(one >> 16) & 0xFF] ^ T[4][one >> 24] ^
+		        T[3][two & 0xFF] ^ T[2][(two >> 8) & 0xFF] ^ T[1][(two >> 16) & 0xFF] ^ T[0][two >> 24];
+	}
+	while (ulLen--) {
+		ulCrc = (ulCrc >> 8) ^ T[0][(ulCrc ^ *pucData++) & 0xFF];
+	}
+	return ulCrc;
+}
+
+static uint32_t _ulCrc32TableNormal(const uint32_t (*T)[256], uint32_t ulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	for (; ulLen >= 8; ulLen -= 8, pucData += 8) {
+		uint32_t one = ulCrc ^ (((uint32_t)pucData[0] << 24) | ((uint32_t)pucData[1] << 16) | ((uint32_t)pucData[2] << 8) | (uint32_t)pucData[3]);
+		uint32_t two = ((uint32_t)pucData[4] << 24) | ((uint32_t)pucData[5] << 16) | ((uint32_t)pucData[6] << 8) | (uint32_t)pucData[7];
+		ulCrc = T[7][one >> 24] ^ T[6][(one >> 16) & 0xFF] ^ T[5][(one >> 8) & 0xFF] ^ T[4][one & 0xFF] ^
+		        T[3][two >> 24] ^ T[2][(two >> 16) & 0xFF] ^ T[1][(two >> 8) & 0xFF] ^ T[0][two & 0xFF];
+	}
+	while (ulLen--) {
+		ulCrc = (ulCrc << 8) ^ T[0][(ulCrc >> 24) ^ *pucData++];
+	}
+	return ulCrc;
+}
+
+static uint32_t _ulCrc32TableUpdate(const Crc32Table_t *pxTable, uint32_t ulCrc, const uint8_t *pucData, uint32_t ulLen) {
+	if (pxTable->bReflected) {
+#ifdef CL_SIMD_X86
+		uint32_t done = _ulCrc32HwReflected(pxTable->ulPoly, &ulCrc, pucData, ulLen);
+		pucData += done;
+		ulLen -= done;
+#endif
+		return _ulCrc32TableReflected(pxTable->aulTable, ulCrc, pucData, ulLen);
+	}
+	return _ulCrc32TableNormal(pxTable->aulTable, ulCrc, pucData, ulLen);
+}
+
+uint32_t ulCrc32Table(const Crc32Table_t *pxTable, const void *pvData, uint32_t ulLen, uint32_t ulInit, Crc32Options_t eOpt) {
+	uint32_t crc = pxTable->bReflected? ulBitReflect(ulInit, 32): ulInit;
+	crc = _ulCrc32TableUpdate(pxTable, crc, (const uint8_t *)pvData, ulLen);
+	return _ulCrc32Out(crc, pxTable->bReflected, eOpt);
+}
+
+void vCrc32Init(Crc32Context_t *pxCtx, uint32_t ulInit, uint32_t ulPoly, Crc32Options_t eOpt, const Crc32Table_t *pxTable) {
+	if (pxTable != libNULL) {
+		ulPoly = pxTable->ulPoly;
+		eOpt = (eOpt & ~CRC32_REFLECT_IN) | (pxTable->bReflected? CRC32_REFLECT_IN: 0);
+	}
+	pxCtx->pxTable = pxTable;
+	pxCtx->ulPoly = ulPoly;
+	pxCtx->eOpt = eOpt;
+	pxCtx->ulCrc = (eOpt & CRC32_REFLECT_IN)? ulBitReflect(ulInit, 32): ulInit;
+}
+
+void vCrc32Update(Crc32Context_t *pxCtx, const void *pvData, uint32_t ulLen) {
+	if (pxCtx->pxTable != libNULL) {
+		pxCtx->ulCrc = _ulCrc32TableUpdate(pxCtx->pxTable, pxCtx->ulCrc, (const uint8_t *)pvData, ulLen);
+	}
+	else {
+		pxCtx->ulCrc = _ulCrc32Nibbles(pxCtx->ulCrc, pxCtx->ulPoly, (pxCtx->eOpt & CRC32_REFLECT_IN) != 0, (const uint8_t *)pvData, ulLen);
+	}
+}
+
+uint32_t ulCrc32Final(const Crc32Context_t *pxCtx) {
+	return _ulCrc32Out(pxCtx->ulCrc, (pxCtx->eOpt & CRC32_REFLECT_IN) != 0, pxCtx->eOpt);
+}
+
+/* Product of polynomials modulo ulPoly, normal form */
+static uint32_t _ulCrc32MulMod(uint32_t a, uint32_t b, uint32_t ulPoly) {
+	uint32_t res = 0;
+	for (uint32_t bit = 1UL << 31; bit != 0; bit >>= 1) {
+		res = (res << 1) ^ ((res & (1UL << 31))? ulPoly: 0);
+		if (a & bit) res ^= b;
 	}
-	return ((crc<<4)|(crc>>4));
+	return res;
+}
+
+/*
+  Register is affine in processed data: reg(init, A|B) = reg(init, A) * x^(8*lenB) + reg(0, B),
+  reg(0, B) = reg(init, B) + init * x^(8*lenB). Math is done with normal form register.
+ */
+uint32_t ulCrc32Combine(uint32_t ulCrcA, uint32_t ulCrcB, uint32_t ulLenB, uint32_t ulInit, uint32_t ulPoly, Crc32Options_t eOpt) {
+	/* Undo output options, value is normal form register then, whatever input order was */
+	if (eOpt & CRC32_INVERT_OUT) {
+		ulCrcA = ~ulCrcA;
+		ulCrcB = ~ulCrcB;
+	}
+	if (eOpt & CRC32_REFLECT_OUT) {
+		ulCrcA = ulBitReflect(ulCrcA, 32);
+		ulCrcB = ulBitReflect(ulCrcB, 32);
+	}
+	/* x^(8*lenB) mod poly by squaring */
+	uint32_t shift = 1;
+	uint32_t sq = 1UL << 8;
+	for (; ulLenB != 0; ulLenB >>= 1) {
+		if (ulLenB & 1) shift = _ulCrc32MulMod(shift, sq, ulPoly);
+		sq = _ulCrc32MulMod(sq, sq, ulPoly);
+	}
+	uint32_t crc = _ulCrc32MulMod(ulCrcA ^ ulInit, shift, ulPoly) ^ ulCrcB;
+	return _ulCrc32Out(crc, CL_FALSE, eOpt);
+}
+
+typedef struct {
+	const Crc32Table_t *pxTable;
+	const uint8_t *pucData;
+	uint32_t ulLen;
+	uint32_t ulInit;
+	uint32_t ulPoly;
+	Crc32Options_t eOpt;
+	uint32_t ulCrc;
+} _Crc32Slice_t;
+
+static void _vCrc32SliceJob(void *pvSlice) {
+	_Crc32Slice_t *slice = (_Crc32Slice_t *)pvSlice;
+	slice->ulCrc = (slice->pxTable != libNULL)?
+		ulCrc32Table(slice->pxTable, slice->pucData, slice->ulLen, slice->ulInit, slice->eOpt):
+		ulCrc32(slice->pucData, slice->ulLen, slice->ulInit, slice->ulPoly, slice->eOpt);
+}
+
+uint32_t ulCrc32Parallel(const void *pvData, uint32_t ulLen, uint32_t ulThreads, uint32_t ulInit, uint32_t ulPoly,
+                         Crc32Options_t eOpt, const Crc32Table_t *pxTable, CrcRunJobs_t pfRun, void *pvRunCtx) {
+	_Crc32Slice_t slices[CRC32_PARALLEL_MAX_SLICES];
+	void *jobs[CRC32_PARALLEL_MAX_SLICES];
+	if (pxTable != libNULL) {
+		ulPoly = pxTable->ulPoly;
+		eOpt = (eOpt & ~CRC32_REFLECT_IN) | (pxTable->bReflected? CRC32_REFLECT_IN: 0);
+	}
+	uint32_t count = CL_MIN(ulThreads, ulLen / CRC32_PARALLEL_MIN_SLICE);
+	count = CL_MIN(count, CRC32_PARALLEL_MAX_SLICES);
+	if ((count < 2) || (pfRun == libNULL)) {
+		return (pxTable != libNULL)? ulCrc32Table(pxTable, pvData, ulLen, ulInit, eOpt):
+		                             ulCrc32(pvData, ulLen, ulInit, ulPoly, eOpt);
+	}
+	const uint8_t *buf = (const uint8_t *)pvData;
+	uint32_t sliceLen = ulLen / count;
+	for (uint32_t i = 0; i < count; i++) {
+		slices[i].pxTable = pxTable;
+		slices[i].pucData = buf + i * sliceLen;
+		slices[i].ulLen = (i == count - 1)? (ulLen - i * sliceLen): sliceLen;
+		slices[i].ulInit = ulInit;
+		slices[i].ulPoly = ulPoly;
+		slices[i].eOpt = eOpt;
+		jobs[i] = &slices[i];
+	}
+	pfRun(_vCrc32SliceJob, jobs, count, pvRunCtx);
+	uint32_t crc = slices[0].ulCrc;
+	for (uint32_t i = 1; i < count; i++) {
+		crc = ulCrc32Combine(crc, slices[i].ulCrc, slices[i].ulLen, ulInit, ulPoly, eOpt);
+	}
+	return crc;
+}
+
+#ifdef CL_CRC_PTHREADS
+
+#include <pthread.h>
+
+typedef struct {
+	void (*pfJob)(void *);
+	void *pvArg;
+} _CrcPthreadJob_t;
+
+static void *_pvCrcPthreadStart(void *pvJob) {
+	_CrcPthreadJob_t *job = (_CrcPthreadJob_t *)pvJob;
+	job->pfJob(job->pvArg);
+	return libNULL;
+}
+
+void vCrcRunPthreads(void (*pfJob)(void *pvArg), void **ppvArgs, uint32_t ulCount, void *pvCtx) {
+	pthread_t threads[CRC32_PARALLEL_MAX_SLICES];
+	_CrcPthreadJob_t jobs[CRC32_PARALLEL_MAX_SLICES];
+	uint8_t started[CRC32_PARALLEL_MAX_SLICES];
+	libUNUSED(pvCtx);
+	uint32_t threadCount = CL_MIN(ulCount, CRC32_PARALLEL_MAX_SLICES);
+	/* Calling thread takes the first job and jobs beyond thread limit, jobs failed to start run in place */
+	for (uint32_t i = 1; i < threadCount; i++) {
+		jobs[i].pfJob = pfJob;
+		jobs[i].pvArg = ppvArgs[i];
+		started[i] = pthread_create(&threads[i], libNULL, _pvCrcPthreadStart, &jobs[i]) == 0;
+		if (!started[i]) pfJob(ppvArgs[i]);
+	}
+	if (ulCount != 0) pfJob(ppvArgs[0]);
+	for (uint32_t i = threadCount; i < ulCount; i++) {
+		pfJob(ppvArgs[i]);
+	}
+	for (uint32_t i = 1; i < threadCount; i++) {
+		if (started[i]) pthread_join(threads[i], libNULL);
+	}
+}
+
+#endif
+
+/* CRC16 Modbus, reflected polynomial 0xA001 */
+static const uint16_t _ausCrc16ModbusTable[256] = {
+	0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+	0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+	0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+	0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+	0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+	0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+	0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+	0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+	0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+	0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+	0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+	0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+	0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+	0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+	0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+	0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+	0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+	0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+	0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+	0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+	0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+	0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+	0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+	0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+	0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+	0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+	0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+	0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+	0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+	0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+	0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+	0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+
+#ifdef CL_CRC16_SLICING_BY_4
+/* Tables to process 4 bytes per step: table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF] */
+static const uint16_t _ausCrc16ModbusSlices[3][256] = {
+	{
+		0x0000, 0x9001, 0x6001, 0xF000, 0xC002, 0x5003, 0xA003, 0x3002,
+		0xC007, 0x5006, 0xA006, 0x3007, 0x0005, 0x9004, 0x6004, 0xF005,
+		0xC00D, 0x500C, 0xA00C, 0x300D, 0x000F, 0x900E, 0x600E, 0xF00F,
+		0x000A, 0x900B, 0x600B, 0xF00A, 0xC008, 0x5009, 0xA009, 0x3008,
+		0xC019, 0x5018, 0xA018, 0x3019, 0x001B, 0x901A, 0x601A, 0xF01B,
+		0x001E, 0x901F, 0x601F, 0xF01E, 0xC01C, 0x501D, 0xA01D, 0x301C,
+		0x0014, 0x9015, 0x6015, 0xF014, 0xC016, 0x5017, 0xA017, 0x3016,
+		0xC013, 0x5012, 0xA012, 0x3013, 0x0011, 0x9010, 0x6010, 0xF011,
+		0xC031, 0x5030, 0xA030, 0x3031, 0x0033, 0x9032, 0x6032, 0xF033,
+		0x0036, 0x9037, 0x6037, 0xF036, 0xC034, 0x5035, 0xA035, 0x3034,
+		0x003C, 0x903D, 0x603D, 0xF03C, 0xC03E, 0x503F, 0xA03F, 0x303E,
+		0xC03B, 0x503A, 0xA03A, 0x303B, 0x0039, 0x9038, 0x6038, 0xF039,
+		0x0028, 0x9029, 0x6029, 0xF028, 0xC02A, 0x502B, 0xA02B, 0x302A,
+		0xC02F, 0x502E, 0xA02E, 0x302F, 0x002D, 0x902C, 0x602C, 0xF02D,
+		0xC025, 0x5024, 0xA024, 0x3025, 0x0027, 0x9026, 0x6026, 0xF027,
+		0x0022, 0x9023, 0x6023, 0xF022, 0xC020, 0x5021, 0xA021, 0x3020,
+		0xC061, 0x5060, 0xA060, 0x3061, 0x0063, 0x9062, 0x6062, 0xF063,
+		0x0066, 0x9067, 0x6067, 0xF066, 0xC064, 0x5065, 0xA065, 0x3064,
+		0x006C, 0x906D, 0x606D, 0xF06C, 0xC06E, 0x506F, 0xA06F, 0x306E,
+		0xC06B, 0x506A, 0xA06A, 0x306B, 0x0069, 0x9068, 0x6068, 0xF069,
+		0x0078, 0x9079, 0x6079, 0xF078, 0xC07A, 0x507B, 0xA07B, 0x307A,
+		0xC07F, 0x507E, 0xA07E, 0x307F, 0x007D, 0x907C, 0x607C, 0xF07D,
+		0xC075, 0x5074, 0xA074, 0x3075, 0x0077, 0x9076, 0x6076, 0xF077,
+		0x0072, 0x9073, 0x6073, 0xF072, 0xC070, 0x5071, 0xA071, 0x3070,
+		0x0050, 0x9051, 0x6051, 0xF050, 0xC052, 0x5053, 0xA053, 0x3052,
+		0xC057, 0x5056, 0xA056, 0x3057, 0x0055, 0x9054, 0x6054, 0xF055,
+		0xC05D, 0x505C, 0xA05C, 0x305D, 0x005F, 0x905E, 0x605E, 0xF05F,
+		0x005A, 0x905B, 0x605B, 0xF05A, 0xC058, 0x5059, 0xA059, 0x3058,
+		0xC049, 0x5048, 0xA048, 0x3049, 0x004B, 0x904A, 0x604A, 0xF04B,
+		0x004E, 0x904F, 0x604F, 0xF04E, 0xC04C, 0x504D, 0xA04D, 0x304C,
+		0x0044, 0x9045, 0x6045, 0xF044, 0xC046, 0x5047, 0xA047, 0x3046,
+		0xC043, 0x5042, 0xA042, 0x3043, 0x0041, 0x9040, 0x6040, 0xF041
+	},
+	{
+		0x0000, 0xC051, 0xC0A1, 0x00F0, 0xC141, 0x0110, 0x01E0, 0xC1B1,
+		0xC281, 0x02D0, 0x0220, 0xC271, 0x03C0, 0xC391, 0xC361, 0x0330,
+		0xC501, 0x0550, 0x05A0, 0xC5F1, 0x0440, 0xC411, 0xC4E1, 0x04B0,
+		0x0780, 0xC7D1, 0xC721, 0x0770, 0xC6C1, 0x0690, 0x0660, 0xC631,
+		0xCA01, 0x0A50, 0x0AA0, 0xCAF1, 0x0B40, 0xCB11, 0xCBE1, 0x0BB0,
+		0x0880, 0xC8D1, 0xC821, 0x0870, 0xC9C1, 0x0990, 0x0960, 0xC931,
+		0x0F00, 0xCF51, 0xCFA1, 0x0FF0, 0xCE41, 0x0E10, 0x0EE0, 0xCEB1,
+		0xCD81, 0x0DD0, 0x0D20, 0xCD71, 0x0CC0, 0xCC91, 0xCC61, 0x0C30,
+		0xD401, 0x1450, 0x14A0, 0xD4F1, 0x1540, 0xD511, 0xD5E1, 0x15B0,
+		0x1680, 0xD6D1, 0xD621, 0x1670, 0xD7C1, 0x1790, 0x1760, 0xD731,
+		0x1100, 0xD151, 0xD1A1, 0x11F0, 0xD041, 0x1010, 0x10E0, 0xD0B1,
+		0xD381, 0x13D0, 0x1320, 0xD371, 0x12C0, 0xD291, 0xD261, 0x1230,
+		0x1E00, 0xDE51, 0xDEA1, 0x1EF0, 0xDF41, 0x1F10, 0x1FE0, 0xDFB1,
+		0xDC81, 0x1CD0, 0x1C20, 0xDC71, 0x1DC0, 0xDD91, 0xDD61, 0x1D30,
+		0xDB01, 0x1B50, 0x1BA0, 0xDBF1, 0x1A40, 0xDA11, 0xDAE1, 0x1AB0,
+		0x1980, 0xD9D1, 0xD921, 0x1970, 0xD8C1, 0x1890, 0x1860, 0xD831,
+		0xE801, 0x2850, 0x28A0, 0xE8F1, 0x2940, 0xE911, 0xE9E1, 0x29B0,
+		0x2A80, 0xEAD1, 0xEA21, 0x2A70, 0xEBC1, 0x2B90, 0x2B60, 0xEB31,
+		0x2D00, 0xED51, 0xEDA1, 0x2DF0, 0xEC41, 0x2C10, 0x2CE0, 0xECB1,
+		0xEF81, 0x2FD0, 0x2F20, 0xEF71, 0x2EC0, 0xEE91, 0xEE61, 0x2E30,
+		0x2200, 0xE251, 0xE2A1, 0x22F0, 0xE341, 0x2310, 0x23E0, 0xE3B1,
+		0xE081, 0x20D0, 0x2020, 0xE071, 0x21C0, 0xE191, 0xE161, 0x2130,
+		0xE701, 0x2750, 0x27A0, 0xE7F1, 0x2640, 0xE611, 0xE6E1, 0x26B0,
+		0x2580, 0xE5D1, 0xE521, 0x2570, 0xE4C1, 0x2490, 0x2460, 0xE431,
+		0x3C00, 0xFC51, 0xFCA1, 0x3CF0, 0xFD41, 0x3D10, 0x3DE0, 0xFDB1,
+		0xFE81, 0x3ED0, 0x3E20, 0xFE71, 0x3FC0, 0xFF91, 0xFF61, 0x3F30,
+		0xF901, 0x3950, 0x39A0, 0xF9F1, 0x3840, 0xF811, 0xF8E1, 0x38B0,
+		0x3B80, 0xFBD1, 0xFB21, 0x3B70, 0xFAC1, 0x3A90, 0x3A60, 0xFA31,
+		0xF601, 0x3650, 0x36A0, 0xF6F1, 0x3740, 0xF711, 0xF7E1, 0x37B0,
+		0x3480, 0xF4D1, 0xF421, 0x3470, 0xF5C1, 0x3590, 0x3560, 0xF531,
+		0x3300, 0xF351, 0xF3A1, 0x33F0, 0xF241, 0x3210, 0x32E0, 0xF2B1,
+		0xF181, 0x31D0, 0x3120, 0xF171, 0x30C0, 0xF091, 0xF061, 0x3030
+	},
+	{
+		0x0000, 0xFC01, 0xB801, 0x4400, 0x3001, 0xCC00, 0x8800, 0x7401,
+		0x6002, 0x9C03, 0xD803, 0x2402, 0x5003, 0xAC02, 0xE802, 0x1403,
+		0xC004, 0x3C05, 0x7805, 0x8404, 0xF005, 0x0C04, 0x4804, 0xB405,
+		0xA006, 0x5C07, 0x1807, 0xE406, 0x9007, 0x6C06, 0x2806, 0xD407,
+		0xC00B, 0x3C0A, 0x780A, 0x840B, 0xF00A, 0x0C0B, 0x480B, 0xB40A,
+		0xA009, 0x5C08, 0x1808, 0xE409, 0x9008, 0x6C09, 0x2809, 0xD408,
+		0x000F, 0xFC0E, 0xB80E, 0x440F, 0x300E, 0xCC0F, 0x880F, 0x740E,
+		0x600D, 0x9C0C, 0xD80C, 0x240D, 0x500C, 0xAC0D, 0xE80D, 0x140C,
+		0xC015, 0x3C14, 0x7814, 0x8415, 0xF014, 0x0C15, 0x4815, 0xB414,
+		0xA017, 0x5C16, 0x1816, 0xE417, 0x9016, 0x6C17, 0x2817, 0xD416,
+		0x0011, 0xFC10, 0xB810, 0x4411, 0x3010, 0xCC11, 0x8811, 0x7410,
+		0x6013, 0x9C12, 0xD812, 0x2413, 0x5012, 0xAC13, 0xE813, 0x1412,
+		0x001E, 0xFC1F, 0xB81F, 0x441E, 0x301F, 0xCC1E, 0x881E, 0x741F,
+		0x601C, 0x9C1D, 0xD81D, 0x241C, 0x501D, 0xAC1C, 0xE81C, 0x141D,
+		0xC01A, 0x3C1B, 0x781B, 0x841A, 0xF01B, 0x0C1A, 0x481A, 0xB41B,
+		0xA018, 0x5C19, 0x1819, 0xE418, 0x9019, 0x6C18, 0x2818, 0xD419,
+		0xC029, 0x3C28, 0x7828, 0x8429, 0xF028, 0x0C29, 0x4829, 0xB428,
+		0xA02B, 0x5C2A, 0x182A, 0xE42B, 0x902A, 0x6C2B, 0x282B, 0xD42A,
+		0x002D, 0xFC2C, 0xB82C, 0x442D, 0x302C, 0xCC2D, 0x882D, 0x742C,
+		0x602F, 0x9C2E, 0xD82E, 0x242F, 0x502E, 0xAC2F, 0xE82F, 0x142E,
+		0x0022, 0xFC23, 0xB823, 0x4422, 0x3023, 0xCC22, 0x8822, 0x7423,
+		0x6020, 0x9C21, 0xD821, 0x2420, 0x5021, 0xAC20, 0xE820, 0x1421,
+		0xC026, 0x3C27, 0x7827, 0x8426, 0xF027, 0x0C26, 0x4826, 0xB427,
+		0xA024, 0x5C25, 0x1825, 0xE424, 0x9025, 0x6C24, 0x2824, 0xD425,
+		0x003C, 0xFC3D, 0xB83D, 0x443C, 0x303D, 0xCC3C, 0x883C, 0x743D,
+		0x603E, 0x9C3F, 0xD83F, 0x243E, 0x503F, 0xAC3E, 0xE83E, 0x143F,
+		0xC038, 0x3C39, 0x7839, 0x8438, 0xF039, 0x0C38, 0x4838, 0xB439,
+		0xA03A, 0x5C3B, 0x183B, 0xE43A, 0x903B, 0x6C3A, 0x283A, 0xD43B,
+		0xC037, 0x3C36, 0x7836, 0x8437, 0xF036, 0x0C37, 0x4837, 0xB436,
+		0xA035, 0x5C34, 0x1834, 0xE435, 0x9034, 0x6C35, 0x2835, 0xD434,
+		0x0033, 0xFC32, 0xB832, 0x4433, 0x3032, 0xCC33, 0x8833, 0x7432,
+		0x6031, 0x9C30, 0xD830, 0x2431, 0x5030, 0xAC31, 0xE831, 0x1430
+	}
+};
+#endif
+
+static uint16_t _usCrc16ModbusUpdate(uint16_t usCrc, const uint8_t *pucData, uint32_t ulLen) {
+#ifdef CL_CRC16_SLICING_BY_4
+	for (; ulLen >= 4; ulLen -= 4, pucData += 4) {
+		uint16_t x = usCrc ^ ((uint16_t)pucData[0] | ((uint16_t)pucData[1] << 8));
+		usCrc = _ausCrc16ModbusSlices[2][x & 0xFF] ^ _ausCrc16ModbusSlices[1][x >> 8] ^
+		        _ausCrc16ModbusSlices[0][pucData[2]] ^ _ausCrc16ModbusTable[pucData[3]];
+	}
+#endif
+	while (ulLen--) {
+		usCrc = (usCrc >> 8) ^ _ausCrc16ModbusTable[(usCrc ^ *pucData++) & 0xFF];
+	}
+	return usCrc;
+}
+
+/*
+  CRC8 Dallas, byte update is table[crc ^ data]. Values keep results of former bitwise code,
+  which swaps nibbles of each byte step, so they differ from catalogue CRC-8/MAXIM-DOW
+ */
+static const uint8_t _aucCrc8DallasTable[256] = {
+	0x00, 0xE5, 0xCB, 0x2E, 0x16, 0xF3, 0xDD, 0x38, 0x2C, 0xC9, 0xE7, 0x02, 0x3A, 0xDF, 0xF1, 0x14,
+	0xD9, 0x3C, 0x12, 0xF7, 0xCF, 0x2A, 0x04, 0xE1, 0xF5, 0x10, 0x3E, 0xDB, 0xE3, 0x06, 0x28, 0xCD,
+	0x32, 0xD7, 0xF9, 0x1C, 0x24, 0xC1, 0xEF, 0x0A, 0x1E, 0xFB, 0xD5, 0x30, 0x08, 0xED, 0xC3, 0x26,
+	0xEB, 0x0E, 0x20, 0xC5, 0xFD, 0x18, 0x36, 0xD3, 0xC7, 0x22, 0x0C, 0xE9, 0xD1, 0x34, 0x1A, 0xFF,
+	0x64, 0x81, 0xAF, 0x4A, 0x72, 0x97, 0xB9, 0x5C, 0x48, 0xAD, 0x83, 0x66, 0x5E, 0xBB, 0x95, 0x70,
+	0xBD, 0x58, 0x76, 0x93, 0xAB, 0x4E, 0x60, 0x85, 0x91, 0x74, 0x5A, 0xBF, 0x87, 0x62, 0x4C, 0xA9,
+	0x56, 0xB3, 0x9D, 0x78, 0x40, 0xA5, 0x8B, 0x6E, 0x7A, 0x9F, 0xB1, 0x54, 0x6C, 0x89, 0xA7, 0x42,
+	0x8F, 0x6A, 0x44, 0xA1, 0x99, 0x7C, 0x52, 0xB7, 0xA3, 0x46, 0x68, 0x8D, 0xB5, 0x50, 0x7E, 0x9B,
+	0xC8, 0x2D, 0x03, 0xE6, 0xDE, 0x3B, 0x15, 0xF0, 0xE4, 0x01, 0x2F, 0xCA, 0xF2, 0x17, 0x39, 0xDC,
+	0x11, 0xF4, 0xDA, 0x3F, 0x07, 0xE2, 0xCC, 0x29, 0x3D, 0xD8, 0xF6, 0x13, 0x2B, 0xCE, 0xE0, 0x05,
+	0xFA, 0x1F, 0x31, 0xD4, 0xEC, 0x09, 0x27, 0xC2, 0xD6, 0x33, 0x1D, 0xF8, 0xC0, 0x25, 0x0B, 0xEE,
+	0x23, 0xC6, 0xE8, 0x0D, 0x35, 0xD0, 0xFE, 0x1B, 0x0F, 0xEA, 0xC4, 0x21, 0x19, 0xFC, 0xD2, 0x37,
+	0xAC, 0x49, 0x67, 0x82, 0xBA, 0x5F, 0x71, 0x94, 0x80, 0x65, 0x4B, 0xAE, 0x96, 0x73, 0x5D, 0xB8,
+	0x75, 0x90, 0xBE, 0x5B, 0x63, 0x86, 0xA8, 0x4D, 0x59, 0xBC, 0x92, 0x77, 0x4F, 0xAA, 0x84, 0x61,
+	0x9E, 0x7B, 0x55, 0xB0, 0x88, 0x6D, 0x43, 0xA6, 0xB2, 0x57, 0x79, 0x9C, 0xA4, 0x41, 0x6F, 0x8A,
+	0x47, 0xA2, 0x8C, 0x69, 0x51, 0xB4, 0x9A, 0x7F, 0x6B, 0x8E, 0xA0, 0x45, 0x7D, 0x98, 0xB6, 0x53
+};
+
+#ifdef CL_CRC8_SLICING_BY_4
+/* Tables to process 4 bytes per step, the update is linear: table[k][i] = table[0][table[k - 1][i]] */
+static const uint8_t _aucCrc8DallasSlices[3][256] = {
+	{
+		0x00, 0x6D, 0xAE, 0xC3, 0x04, 0x69, 0xAA, 0xC7, 0x08, 0x65, 0xA6, 0xCB, 0x0C, 0x61, 0xA2, 0xCF,
+		0xBC, 0xD1, 0x12, 0x7F, 0xB8, 0xD5, 0x16, 0x7B, 0xB4, 0xD9, 0x1A, 0x77, 0xB0, 0xDD, 0x1E, 0x73,
+		0x20, 0x4D, 0x8E, 0xE3, 0x24, 0x49, 0x8A, 0xE7, 0x28, 0x45, 0x86, 0xEB, 0x2C, 0x41, 0x82, 0xEF,
+		0x9C, 0xF1, 0x32, 0x5F, 0x98, 0xF5, 0x36, 0x5B, 0x94, 0xF9, 0x3A, 0x57, 0x90, 0xFD, 0x3E, 0x53,
+		0x40, 0x2D, 0xEE, 0x83, 0x44, 0x29, 0xEA, 0x87, 0x48, 0x25, 0xE6, 0x8B, 0x4C, 0x21, 0xE2, 0x8F,
+		0xFC, 0x91, 0x52, 0x3F, 0xF8, 0x95, 0x56, 0x3B, 0xF4, 0x99, 0x5A, 0x37, 0xF0, 0x9D, 0x5E, 0x33,
+		0x60, 0x0D, 0xCE, 0xA3, 0x64, 0x09, 0xCA, 0xA7, 0x68, 0x05, 0xC6, 0xAB, 0x6C, 0x01, 0xC2, 0xAF,
+		0xDC, 0xB1, 0x72, 0x1F, 0xD8, 0xB5, 0x76, 0x1B, 0xD4, 0xB9, 0x7A, 0x17, 0xD0, 0xBD, 0x7E, 0x13,
+		0x80, 0xED, 0x2E, 0x43, 0x84, 0xE9, 0x2A, 0x47, 0x88, 0xE5, 0x26, 0x4B, 0x8C, 0xE1, 0x22, 0x4F,
+		0x3C, 0x51, 0x92, 0xFF, 0x38, 0x55, 0x96, 0xFB, 0x34, 0x59, 0x9A, 0xF7, 0x30, 0x5D, 0x9E, 0xF3,
+		0xA0, 0xCD, 0x0E, 0x63, 0xA4, 0xC9, 0x0A, 0x67, 0xA8, 0xC5, 0x06, 0x6B, 0xAC, 0xC1, 0x02, 0x6F,
+		0x1C, 0x71, 0xB2, 0xDF, 0x18, 0x75, 0xB6, 0xDB, 0x14, 0x79, 0xBA, 0xD7, 0x10, 0x7D, 0xBE, 0xD3,
+		0xC0, 0xAD, 0x6E, 0x03, 0xC4, 0xA9, 0x6A, 0x07, 0xC8, 0xA5, 0x66, 0x0B, 0xCC, 0xA1, 0x62, 0x0F,
+		0x7C, 0x11, 0xD2, 0xBF, 0x78, 0x15, 0xD6, 0xBB, 0x74, 0x19, 0xDA, 0xB7, 0x70, 0x1D, 0xDE, 0xB3,
+		0xE0, 0x8D, 0x4E, 0x23, 0xE4, 0x89, 0x4A, 0x27, 0xE8, 0x85, 0x46, 0x2B, 0xEC, 0x81, 0x42, 0x2F,
+		0x5C, 0x31, 0xF2, 0x9F, 0x58, 0x35, 0xF6, 0x9B, 0x54, 0x39, 0xFA, 0x97, 0x50, 0x3D, 0xFE, 0x93
+	},
+	{
+		0x00, 0x89, 0x0B, 0x82, 0x16, 0x9F, 0x1D, 0x94, 0x2C, 0xA5, 0x27, 0xAE, 0x3A, 0xB3, 0x31, 0xB8,
+		0x19, 0x90, 0x12, 0x9B, 0x0F, 0x86, 0x04, 0x8D, 0x35, 0xBC, 0x3E, 0xB7, 0x23, 0xAA, 0x28, 0xA1,
+		0x32, 0xBB, 0x39, 0xB0, 0x24, 0xAD, 0x2F, 0xA6, 0x1E, 0x97, 0x15, 0x9C, 0x08, 0x81, 0x03, 0x8A,
+		0x2B, 0xA2, 0x20, 0xA9, 0x3D, 0xB4, 0x36, 0xBF, 0x07, 0x8E, 0x0C, 0x85, 0x11, 0x98, 0x1A, 0x93,
+		0x64, 0xED, 0x6F, 0xE6, 0x72, 0xFB, 0x79, 0xF0, 0x48, 0xC1, 0x43, 0xCA, 0x5E, 0xD7, 0x55, 0xDC,
+		0x7D, 0xF4, 0x76, 0xFF, 0x6B, 0xE2, 0x60, 0xE9, 0x51, 0xD8, 0x5A, 0xD3, 0x47, 0xCE, 0x4C, 0xC5,
+		0x56, 0xDF, 0x5D, 0xD4, 0x40, 0xC9, 0x4B, 0xC2, 0x7A, 0xF3, 0x71, 0xF8, 0x6C, 0xE5, 0x67, 0xEE,
+		0x4F, 0xC6, 0x44, 0xCD, 0x59, 0xD0, 0x52, 0xDB, 0x63, 0xEA, 0x68, 0xE1, 0x75, 0xFC, 0x7E, 0xF7,
+		0xC8, 0x41, 0xC3, 0x4A, 0xDE, 0x57, 0xD5, 0x5C, 0xE4, 0x6D, 0xEF, 0x66, 0xF2, 0x7B, 0xF9, 0x70,
+		0xD1, 0x58, 0xDA, 0x53, 0xC7, 0x4E, 0xCC, 0x45, 0xFD, 0x74, 0xF6, 0x7F, 0xEB, 0x62, 0xE0, 0x69,
+		0xFA, 0x73, 0xF1, 0x78, 0xEC, 0x65, 0xE7, 0x6E, 0xD6, 0x5F, 0xDD, 0x54, 0xC0, 0x49, 0xCB, 0x42,
+		0xE3, 0x6A, 0xE8, 0x61, 0xF5, 0x7C, 0xFE, 0x77, 0xCF, 0x46, 0xC4, 0x4D, 0xD9, 0x50, 0xD2, 0x5B,
+		0xAC, 0x25, 0xA7, 0x2E, 0xBA, 0x33, 0xB1, 0x38, 0x80, 0x09, 0x8B, 0x02, 0x96, 0x1F, 0x9D, 0x14,
+		0xB5, 0x3C, 0xBE, 0x37, 0xA3, 0x2A, 0xA8, 0x21, 0x99, 0x10, 0x92, 0x1B, 0x8F, 0x06, 0x84, 0x0D,
+		0x9E, 0x17, 0x95, 0x1C, 0x88, 0x01, 0x83, 0x0A, 0xB2, 0x3B, 0xB9, 0x30, 0xA4, 0x2D, 0xAF, 0x26,
+		0x87, 0x0E, 0x8C, 0x05, 0x91, 0x18, 0x9A, 0x13, 0xAB, 0x22, 0xA0, 0x29, 0xBD, 0x34, 0xB6, 0x3F
+	},
+	{
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+		0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+		0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+		0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+		0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+		0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+		0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+		0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+		0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+		0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+		0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+		0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+		0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+		0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+		0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+	}
+};
+#endif
+
+static uint8_t _ucCrc8DallasUpdate(uint8_t ucCrc, const uint8_t *pucData, uint32_t ulLen) {
+#ifdef CL_CRC8_SLICING_BY_4
+	for (; ulLen >= 4; ulLen -= 4, pucData += 4) {
+		ucCrc = _aucCrc8DallasSlices[2][ucCrc ^ pucData[0]] ^ _aucCrc8DallasSlices[1][pucData[1]] ^
+		        _aucCrc8DallasSlices[0][pucData[2]] ^ _aucCrc8DallasTable[pucData[3]];
+	}
+#endif
+	while (ulLen--) {
+		ucCrc = _aucCrc8DallasTable[ucCrc ^ *pucData++];
+	}
+	return ucCrc;
 }
 
 uint8_t ucCrc8Dallas(const uint8_t *pucData, uint32_t ulLen, const uint8_t *pucCrc) {
@@ -46,25 +664,77 @@ uint8_t ucCrc8Dallas(const uint8_t *pucData, uint32_t ulLen, const uint8_t *pucC
 	if (pucCrc != libNULL) {
 		crc = *pucCrc;
 	}
-	for (uint32_t i = 0; i < ulLen; ++i) {
-		crc = _ucCrc8DallasNext(pucData[i] ^ crc);
-	}
-	return crc;
+	return _ucCrc8DallasUpdate(crc, pucData, ulLen);
 }
 
 uint16_t usCrc16ModbusRtu(const uint8_t *pucData, uint16_t usLen, const uint16_t *pusCrc) {
 	uint16_t crc = 0xFFFF;
 	if (pusCrc != libNULL) crc = *pusCrc;
 	if (pucData != libNULL) {
-		while (usLen--) crc = _usCrc16ModbusRtuNext(crc, *pucData++);
+		crc = _usCrc16ModbusUpdate(crc, pucData, usLen);
 	}
 	return crc;
 }
 
+void vCrc16ModbusRtuInit(Crc16Context_t *pxCtx) {
+	pxCtx->usCrc = 0xFFFF;
+}
+
+void vCrc16ModbusRtuUpdate(Crc16Context_t *pxCtx, const uint8_t *pucData, uint32_t ulLen) {
+	pxCtx->usCrc = _usCrc16ModbusUpdate(pxCtx->usCrc, pucData, ulLen);
+}
+
+uint16_t usCrc16ModbusRtuFinal(const Crc16Context_t *pxCtx) {
+	return pxCtx->usCrc;
+}
+
+void vCrc8DallasInit(Crc8Context_t *pxCtx) {
+	pxCtx->ucCrc = 0;
+}
+
+void vCrc8DallasUpdate(Crc8Context_t *pxCtx, const uint8_t *pucData, uint32_t ulLen) {
+	pxCtx->ucCrc = _ucCrc8DallasUpdate(pxCtx->ucCrc, pucData, ulLen);
+}
+
+uint8_t ucCrc8DallasFinal(const Crc8Context_t *pxCtx) {
+	return pxCtx->ucCrc;
+}
+
 
 uint32_t crc32(const void *data, uint32_t len, uint32_t init, const uint32_t poly, crc32_options_t opt)\
                                                   __attribute__ ((alias ("ulCrc32")));
+void crc32_table_init(crc32_table_t *table, uint32_t poly, crc32_options_t opt)\
+                                                  __attribute__ ((alias ("vCrc32TableInit")));
+uint32_t crc32_table(const crc32_table_t *table, const void *data, uint32_t len, uint32_t init, crc32_options_t opt)\
+                                                  __attribute__ ((alias ("ulCrc32Table")));
+void crc32_init(crc32_context_t *ctx, uint32_t init, uint32_t poly, crc32_options_t opt, const crc32_table_t *table)\
+                                                  __attribute__ ((alias ("vCrc32Init")));
+void crc32_update(crc32_context_t *ctx, const void *data, uint32_t len)\
+                                                  __attribute__ ((alias ("vCrc32Update")));
+uint32_t crc32_final(const crc32_context_t *ctx)\
+                                                  __attribute__ ((alias ("ulCrc32Final")));
+uint32_t crc32_combine(uint32_t crc_a, uint32_t crc_b, uint32_t len_b, uint32_t init, uint32_t poly, crc32_options_t opt)\
+                                                  __attribute__ ((alias ("ulCrc32Combine")));
+uint32_t crc32_parallel(const void *data, uint32_t len, uint32_t threads, uint32_t init, uint32_t poly,
+                        crc32_options_t opt, const crc32_table_t *table, crc_run_jobs_t run, void *run_ctx)\
+                                                  __attribute__ ((alias ("ulCrc32Parallel")));
+#ifdef CL_CRC_PTHREADS
+void crc_run_pthreads(void (*job)(void *arg), void **args, uint32_t count, void *ctx)\
+                                                  __attribute__ ((alias ("vCrcRunPthreads")));
+#endif
 uint16_t crc16_modbus_rtu(const uint8_t *data, uint16_t len, const uint16_t *crc)\
                                                   __attribute__ ((alias ("usCrc16ModbusRtu")));
+void crc16_modbus_rtu_init(crc16_context_t *ctx)\
+                                                  __attribute__ ((alias ("vCrc16ModbusRtuInit")));
+void crc16_modbus_rtu_update(crc16_context_t *ctx, const uint8_t *data, uint32_t len)\
+                                                  __attribute__ ((alias ("vCrc16ModbusRtuUpdate")));
+uint16_t crc16_modbus_rtu_final(const crc16_context_t *ctx)\
+                                                  __attribute__ ((alias ("usCrc16ModbusRtuFinal")));
 uint8_t crc8_dallas(const uint8_t *data, uint32_t len, const uint8_t *crc)\
                                                   __attribute__ ((alias ("ucCrc8Dallas")));
+void crc8_dallas_init(crc8_context_t *ctx)\
+                                                  __attribute__ ((alias ("vCrc8DallasInit")));
+void crc8_dallas_update(crc8_context_t *ctx, const uint8_t *data, uint32_t len)\
+                                                  __attribute__ ((alias ("vCrc8DallasUpdate")));
+uint8_t crc8_dallas_final(const crc8_context_t *ctx)\
+                                                  __attribute__ ((alias ("ucCrc8DallasFinal")));
@@ -33,6 +33,140 @@ uint32_t HashKnuth (void *pxData, uint32_t ulSize) {
     return hash;
 }
 
+/* XXH64, xxHash specification by Yann Collet */
+#define XXH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define XXH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define XXH_PRIME64_3 0x165667B19E3779F9ULL
+#define XXH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+#define XXH_PRIME64_5 0x27D4EB2F165667C5ULL
+
+static inline uint64_t _ullXxhRotl(uint64_t ullVal, uint8_t ucBits) {
+    return (ullVal << ucBits) | (ullVal >> (64 - ucBits));
+}
+
+static inline uint64_t _ullXxhRead64(const uint8_t *pucData) {
+    return (uint64_t)pucData[0] | ((uint64_t)pucData[1] << 8) | ((uint64_t)pucData[2] << 16) | ((uint64_t)pucData[3] << 24) |
+           ((uint64_t)pucData[4] << 32) | ((uint64_t)pucData[5] << 40) | ((uint64_t)pucData[6] << 48) | ((uint64_t)pucData[7] << 56);
+}
+
+static inline uint32_t _ulXxhRead32(const uint8_t *pucData) {
+    return (uint32_t)pucData[0] | ((uint32_t)pucData[1] << 8) | ((uint32_t)pucData[2] << 16) | ((uint32_t)pucData[3] << 24);
+}
+
+static inline uint64_t _ullXxhRound(uint64_t ullAcc, uint64_t ullInput) {
+    ullAcc += ullInput * XXH_PRIME64_2;
+    ullAcc = _ullXxhRotl(ullAcc, 31);
+    return ullAcc * XXH_PRIME64_1;
+}
+
+static inline uint64_t _ullXxhMergeRound(uint64_t ullAcc, uint64_t ullVal) {
+    ullAcc ^= _ullXxhRound(0, ullVal);
+    return ullAcc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+/* Consume 32 bytes stripes, return consumed bytes count */
+static uint32_t _ulXxhStripes(uint64_t *pullAcc, const uint8_t *pucData, uint32_t ulSize) {
+    uint64_t v1 = pullAcc[0], v2 = pullAcc[1], v3 = pullAcc[2], v4 = pullAcc[3];
+    uint32_t i = 0;
+    for (; i + 32 <= ulSize; i += 32) {
+        v1 = _ullXxhRound(v1, _ullXxhRead64(pucData + i));
+        v2 = _ullXxhRound(v2, _ullXxhRead64(pucData + i + 8));
+        v3 = _ullXxhRound(v3, _ullXxhRead64(pucData + i + 16));
+        v4 = _ullXxhRound(v4, _ullXxhRead64(pucData + i + 24));
+    }
+    pullAcc[0] = v1; pullAcc[1] = v2; pullAcc[2] = v3; pullAcc[3] = v4;
+    return i;
+}
+
+static void _vXxhAccInit(uint64_t *pullAcc, uint64_t ullSeed) {
+    pullAcc[0] = ullSeed + XXH_PRIME64_1 + XXH_PRIME64_2;
+    pullAcc[1] = ullSeed + XXH_PRIME64_2;
+    pullAcc[2] = ullSeed;
+    pullAcc[3] = ullSeed - XXH_PRIME64_1;
+}
+
+static uint64_t _ullXxhAccMerge(const uint64_t *pullAcc) {
+    uint64_t hash = _ullXxhRotl(pullAcc[0], 1) + _ullXxhRotl(pullAcc[1], 7) +
+                    _ullXxhRotl(pullAcc[2], 12) + _ullXxhRotl(pullAcc[3], 18);
+    hash = _ullXxhMergeRound(hash, pullAcc[0]);
+    hash = _ullXxhMergeRound(hash, pullAcc[1]);
+    hash = _ullXxhMergeRound(hash, pullAcc[2]);
+    return _ullXxhMergeRound(hash, pullAcc[3]);
+}
+
+/* Tail shorter than 32 bytes and final avalanche */
+static uint64_t _ullXxhFinalize(uint64_t ullHash, const uint8_t *pucData, uint32_t ulSize) {
+    for (; ulSize >= 8; ulSize -= 8, pucData += 8) {
+        ullHash ^= _ullXxhRound(0, _ullXxhRead64(pucData));
+        ullHash = _ullXxhRotl(ullHash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+    if (ulSize >= 4) {
+        ullHash ^= (uint64_t)_ulXxhRead32(pucData) * XXH_PRIME64_1;
+        ullHash = _ullXxhRotl(ullHash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        pucData += 4;
+        ulSize -= 4;
+    }
+    while (ulSize--) {
+        ullHash ^= (*pucData++) * XXH_PRIME64_5;
+        ullHash = _ullXxhRotl(ullHash, 11) * XXH_PRIME64_1;
+    }
+    ullHash ^= ullHash >> 33;
+    ullHash *= XXH_PRIME64_2;
+    ullHash ^= ullHash >> 29;
+    ullHash *= XXH_PRIME64_3;
+    ullHash ^= ullHash >> 32;
+    return ullHash;
+}
+
+uint64_t HashXxh64 (const void *pxData, uint32_t ulSize, uint64_t ullSeed) {
+    const uint8_t *data = pxData;
+    uint64_t hash;
+    if (ulSize >= 32) {
+        uint64_t acc[4];
+        _vXxhAccInit(acc, ullSeed);
+        uint32_t done = _ulXxhStripes(acc, data, ulSize);
+        data += done;
+        hash = _ullXxhAccMerge(acc);
+        hash += ulSize;
+        return _ullXxhFinalize(hash, data, ulSize - done);
+    }
+    hash = ullSeed + XXH_PRIME64_5 + ulSize;
+    return _ullXxhFinalize(hash, data, ulSize);
+}
+
+void HashXxh64Init (HashXxh64Context_t *pxCtx, uint64_t ullSeed) {
+    _vXxhAccInit(pxCtx->aullAcc, ullSeed);
+    pxCtx->ullSeed = ullSeed;
+    pxCtx->ullTotalSize = 0;
+    pxCtx->ulBufferedSize = 0;
+}
+
+void HashXxh64Update (HashXxh64Context_t *pxCtx, const void *pxData, uint32_t ulSize) {
+    const uint8_t *data = pxData;
+    pxCtx->ullTotalSize += ulSize;
+    if (pxCtx->ulBufferedSize + ulSize < 32) {
+        mem_cpy(pxCtx->aucBuffer + pxCtx->ulBufferedSize, data, ulSize);
+        pxCtx->ulBufferedSize += ulSize;
+        return;
+    }
+    if (pxCtx->ulBufferedSize != 0) {
+        uint32_t fill = 32 - pxCtx->ulBufferedSize;
+        mem_cpy(pxCtx->aucBuffer + pxCtx->ulBufferedSize, data, fill);
+        _ulXxhStripes(pxCtx->aullAcc, pxCtx->aucBuffer, 32);
+        data += fill;
+        ulSize -= fill;
+    }
+    uint32_t done = _ulXxhStripes(pxCtx->aullAcc, data, ulSize);
+    pxCtx->ulBufferedSize = ulSize - done;
+    mem_cpy(pxCtx->aucBuffer, data + done, pxCtx->ulBufferedSize);
+}
+
+uint64_t HashXxh64Final (const HashXxh64Context_t *pxCtx) {
+    uint64_t hash = (pxCtx->ullTotalSize >= 32)? _ullXxhAccMerge(pxCtx->aullAcc): (pxCtx->ullSeed + XXH_PRIME64_5);
+    hash += pxCtx->ullTotalSize;
+    return _ullXxhFinalize(hash, pxCtx->aucBuffer, pxCtx->ulBufferedSize);
+}
+
 /*!
   Snake notation
 */
@@ -40,3 +174,7 @@ uint32_t HashKnuth (void *pxData, uint32_t ulSize) {
 uint32_t hash_dbj2 (void *data, uint32_t size)  __attribute__ ((alias ("HashDjb2")));
 uint32_t hash_sdbm (void *data, uint32_t size)  __attribute__ ((alias ("HashSdbm")));
 uint32_t hash_knuth (void *data, uint32_t size)  __attribute__ ((alias ("HashKnuth")));
+uint64_t hash_xxh64 (const void *data, uint32_t size, uint64_t seed)  __attribute__ ((alias ("HashXxh64")));
+void hash_xxh64_init (hash_xxh64_context_t *ctx, uint64_t seed)  __attribute__ ((alias ("HashXxh64Init")));
+void hash_xxh64_update (hash_xxh64_context_t *ctx, const void *data, uint32_t size)  __attribute__ ((alias ("HashXxh64Update")));
+uint64_t hash_xxh64_final (const hash_xxh64_context_t *ctx)  __attribute__ ((alias ("HashXxh64Final")));
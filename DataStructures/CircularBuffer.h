@@ -13,7 +13,20 @@
 extern "C" {
 #endif
 
+/*!
+	Buffers size and index type, shared with fifo buffer interface.
+	Define CL_CIRCULAR_BUFFER_WIDE_INDEX to use buffers larger than 64 KiB.
+	Note: with wide index flush, backup, restore and commit update tail and head
+	with two accesses on 32-bit targets and are not ISR safe: mask interrupts
+	around them if buffer is read or writed from ISR.
+*/
+#ifdef CL_CIRCULAR_BUFFER_WIDE_INDEX
+typedef uint32_t BufferSize_t;
+#define CIRCULAR_BUFFER_DESCRIPTOR_SIZE 24
+#else
+typedef uint16_t BufferSize_t;
 #define CIRCULAR_BUFFER_DESCRIPTOR_SIZE 12
+#endif
 
 typedef struct {
 	CL_PRIVATE(CIRCULAR_BUFFER_DESCRIPTOR_SIZE);
@@ -25,7 +38,7 @@ typedef struct {
 	@param[in] uBufferSize          Buffer length
 	@return Pointer to circular buffer descriptor
 */
-CircularBuffer_t *pxCircularBufferInit(uint8_t *pucBuffer, uint16_t uBufferSize);
+CircularBuffer_t *pxCircularBufferInit(uint8_t *pucBuffer, BufferSize_t uBufferSize);
 
 /*!
 	@brief Get available data count
@@ -50,7 +63,7 @@ int32_t lCircularBufferFree(CircularBuffer_t *pxDescriptor);
 	@param[in] bToPeek           If need not shift data from circular buffer
 	@return Copyed data bytes count
 */
-int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucDestBuf, uint16_t uCount, uint16_t uSkip, uint8_t bToPeek);
+int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucDestBuf, BufferSize_t uCount, BufferSize_t uSkip, uint8_t bToPeek);
 
 /*!
 	@brief Write data to circular buffer
@@ -62,7 +75,32 @@ int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucDestBuf,
 	@param[in] bAsString         Will copy data bytes before uCount reached or string terminator found
 	@return Writed data bytes count
 */
-int32_t lCircularBufferWrite(CircularBuffer_t *pxDescriptor, const uint8_t *pucData, uint16_t uCount, uint8_t bFill, uint8_t bPutAll, uint8_t bAsString);
+int32_t lCircularBufferWrite(CircularBuffer_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFill, uint8_t bPutAll, uint8_t bAsString);
+
+/*!
+	@brief Get contiguous data chunk without copying
+	@param[in] pxDescriptor      Circular buffer descriptor
+	@param[in] uSkip             Data bytes count to skip before chunk
+	@param[out] ppucSpan         Pointer to the chunk
+	@return Chunk length
+*/
+int32_t lCircularBufferReadSpan(CircularBuffer_t *pxDescriptor, BufferSize_t uSkip, const uint8_t **ppucSpan);
+
+/*!
+	@brief Get contiguous free space to place data in directly
+	@param[in] pxDescriptor      Circular buffer descriptor
+	@param[out] ppucBuffer       Pointer to the free space
+	@return Contiguous free space length
+*/
+int32_t lCircularBufferWriteReserve(CircularBuffer_t *pxDescriptor, uint8_t **ppucBuffer);
+
+/*!
+	@brief Mark data placed in reserved space as writed
+	@param[in] pxDescriptor      Circular buffer descriptor
+	@param[in] uCount            Placed data bytes count
+	@return Commited data bytes count
+*/
+int32_t lCircularBufferWriteCommit(CircularBuffer_t *pxDescriptor, BufferSize_t uCount);
 
 /*!
 	@brief Backup circular buffer state, followed operations will could be canceled
@@ -95,6 +133,7 @@ void vCircularBufferFlush(CircularBuffer_t *pxDescriptor);
   Snake notation
 */
 
+typedef BufferSize_t buffer_size_t;
 typedef CircularBuffer_t circular_buffer_t;
 
 /*!
@@ -103,7 +142,7 @@ typedef CircularBuffer_t circular_buffer_t;
 	@param[in] buffer_size       Buffer length
 	@return Pointer to circular buffer descriptor
 */
-circular_buffer_t *circular_buffer_init(uint8_t *buffer, uint16_t buffer_size);
+circular_buffer_t *circular_buffer_init(uint8_t *buffer, buffer_size_t buffer_size);
 
 /*!
 	@brief Get available data count
@@ -128,7 +167,7 @@ int32_t circular_buffer_free(circular_buffer_t *desc);
 	@param[in] to_peek   If need not shift data from circular buffer
 	@return Copyed data bytes count
 */
-int32_t circular_buffer_read(circular_buffer_t *desc, uint8_t *dest, uint16_t count, uint16_t skip, uint8_t to_peek);
+int32_t circular_buffer_read(circular_buffer_t *desc, uint8_t *dest, buffer_size_t count, buffer_size_t skip, uint8_t to_peek);
 
 /*!
 	@brief Write data to circular buffer
@@ -140,7 +179,32 @@ int32_t circular_buffer_read(circular_buffer_t *desc, uint8_t *dest, uint16_t co
 	@param[in] as_string Will copy data bytes before <count> reached or string terminator found
 	@return Writed data bytes count
 */
-int32_t circular_buffer_write(circular_buffer_t *desc, const uint8_t *data, uint16_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string);
+int32_t circular_buffer_write(circular_buffer_t *desc, const uint8_t *data, buffer_size_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string);
+
+/*!
+	@brief Get contiguous data chunk without copying
+	@param[in] desc      Circular buffer descriptor
+	@param[in] skip      Data bytes count to skip before chunk
+	@param[out] span     Pointer to the chunk
+	@return Chunk length
+*/
+int32_t circular_buffer_read_span(circular_buffer_t *desc, buffer_size_t skip, const uint8_t **span);
+
+/*!
+	@brief Get contiguous free space to place data in directly
+	@param[in] desc      Circular buffer descriptor
+	@param[out] buffer   Pointer to the free space
+	@return Contiguous free space length
+*/
+int32_t circular_buffer_write_reserve(circular_buffer_t *desc, uint8_t **buffer);
+
+/*!
+	@brief Mark data placed in reserved space as writed
+	@param[in] desc      Circular buffer descriptor
+	@param[in] count     Placed data bytes count
+	@return Commited data bytes count
+*/
+int32_t circular_buffer_write_commit(circular_buffer_t *desc, buffer_size_t count);
 
 /*!
 	@brief Backup circular buffer state, followed operations will could be canceled
@@ -17,7 +17,7 @@ extern "C" {
 
 typedef PrintIntegerFlags_t FifoPrintIntegerFlags_t;
 
-#define FIFIO_DESCRIPTOR_SIZE    12
+#define FIFIO_DESCRIPTOR_SIZE    (2 * sizeof(void *) + 8)
 
 /*!
 	@brief Initialize buffer, storing self descriptor with in provaded users buffer is allowed
@@ -25,7 +25,7 @@ typedef PrintIntegerFlags_t FifoPrintIntegerFlags_t;
 	@param[in] uBufferSize          Buffer length
 	@return Pointer to buffer descriptor
 */
-typedef void *(*BufferInit_t)(uint8_t *pucBuffer, uint16_t uBufferSize);
+typedef void *(*BufferInit_t)(uint8_t *pucBuffer, BufferSize_t uBufferSize);
 
 /*!
 	@brief Used for basic buffer operations
@@ -50,7 +50,7 @@ typedef uint8_t (*BufferBaseBool_t)(void *pxDescriptor);
 	@param[in] bToPeek           Lave data in buffer
 	@return Copyed data bytes count
 */
-typedef int32_t (*BufferRead_t)(void *pxDescriptor, uint8_t *pucDest, uint16_t uTake, uint16_t uSkip, uint8_t bToPeek);
+typedef int32_t (*BufferRead_t)(void *pxDescriptor, uint8_t *pucDest, BufferSize_t uTake, BufferSize_t uSkip, uint8_t bToPeek);
 
 /*!
 	@brief Write data to fifo buffer
@@ -62,7 +62,50 @@ typedef int32_t (*BufferRead_t)(void *pxDescriptor, uint8_t *pucDest, uint16_t u
 	@param[in] bAsString         Write data bytes before uCount reached or string terminator met
 	@return Writed data bytes count
 */
-typedef int32_t (*BufferWrite_t)(void *pxDescriptor, const uint8_t *pucData, uint16_t uCount, uint8_t bFill, uint8_t bPutAll, uint8_t bAsString);
+typedef int32_t (*BufferWrite_t)(void *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFill, uint8_t bPutAll, uint8_t bAsString);
+
+/*!
+	@brief Get contiguous free space to place data in directly
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[out] ppucBuffer       Pointer to the free space
+	@return Contiguous free space length
+*/
+typedef int32_t (*BufferReserve_t)(void *pxDescriptor, uint8_t **ppucBuffer);
+
+/*!
+	@brief Mark data placed in reserved space as writed
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] uCount            Placed data bytes count
+	@return Commited data bytes count
+*/
+typedef int32_t (*BufferCommit_t)(void *pxDescriptor, BufferSize_t uCount);
+
+/*!
+	@brief Get contiguous data chunk without copying
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] uSkip             Data bytes count to skip before chunk
+	@param[out] ppucSpan         Pointer to the chunk
+	@return Chunk length
+*/
+typedef int32_t (*BufferReadSpan_t)(void *pxDescriptor, BufferSize_t uSkip, const uint8_t **ppucSpan);
+
+/*!
+	@brief Claim exact free space, claims of concurrent producers never overlap
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] uCount            Space length
+	@param[out] apucSpans        Claimed space, continues from the second span when it wraps the buffer end
+	@param[out] pulTicket        Claim ticket to publish space with
+	@return First span length, <0 if not enough free space
+*/
+typedef int32_t (*BufferClaim_t)(void *pxDescriptor, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket);
+
+/*!
+	@brief Publish data placed in claimed space
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] ulTicket          Claim ticket
+	@param[in] uCount            Claimed space length
+*/
+typedef void (*BufferPublish_t)(void *pxDescriptor, uint32_t ulTicket, BufferSize_t uCount);
 
 typedef struct {
 	BufferInit_t pfBufferInit;
@@ -78,8 +121,18 @@ typedef struct {
 	BufferBaseBool_t pfBufferBackup; /* backup buffer state; return: !0 if ok*/
 	BufferBaseBool_t pfBufferCommit; /* apply all changes after backup; return: !0 if ok */
 	BufferBaseBool_t pfBufferRestore; /* cancel all changes after backup; return: !0 if ok */
+	BufferReserve_t pfBufferWriteReserve; /* optional, get contiguous free space; return: space length */
+	BufferCommit_t pfBufferWriteCommit; /* optional, mark reserved space as writed; return: commited count */
+	BufferReadSpan_t pfBufferReadSpan; /* optional, get contiguous data chunk; return: chunk length */
+	BufferClaim_t pfBufferClaim; /* optional, multi producer buffers: claim exact free space; return: first span length */
+	BufferPublish_t pfBufferPublish; /* optional, multi producer buffers: publish claimed space */
 } FifoIfaceEx_t;
 
+typedef struct {
+	const uint8_t *pucData;
+	BufferSize_t uLen;
+} FifoSpan_t;
+
 typedef struct {
 	const FifoIface_t *pxIface; /* provide buffer methods */
 	const FifoIfaceEx_t *pxIfaceEx; /* optionally provide extended buffer methods */
@@ -94,7 +147,7 @@ typedef struct {
 	@param[in] bDoubleBufferization Use double bufferization for usage fifo with in interrupts
 	@return !NULL if init ok
 */
-uint8_t bFifoInit(Fifo_t *pxFifo, uint8_t *pucBuffer, uint16_t uSize, uint8_t bDoubleBufferization);
+uint8_t bFifoInit(Fifo_t *pxFifo, uint8_t *pucBuffer, BufferSize_t uSize, uint8_t bDoubleBufferization);
 
 /*!
 	@brief Validate fifo descriptor
@@ -118,6 +171,32 @@ int32_t lFifoAvailableToRead(Fifo_t *xpFifo);
 int32_t lFifoAvailableToWrite(Fifo_t *xpFifo);
 
 
+#ifdef CL_FIFO_WAIT
+
+#define FIFO_WAIT_FOREVER        ((uint32_t)0xFFFFFFFF)
+
+/*!
+	@brief Block calling thread till data available, Linux only.
+	       Writers wake waiting threads, no syscalls made while nobody waits.
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] uMinCount		Data bytes count to wait for
+	@param[in] ulTimeout		Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout, 0 to poll
+	@return Bytes count available to be readed, less than uMinCount on timeout, <0 if error
+*/
+int32_t lFifoWaitReadable(Fifo_t *xpFifo, BufferSize_t uMinCount, uint32_t ulTimeout);
+
+/*!
+	@brief Block calling thread till free space available, Linux only.
+	       Readers wake waiting threads, no syscalls made while nobody waits.
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] uMinCount		Free space to wait for
+	@param[in] ulTimeout		Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout, 0 to poll
+	@return Bytes count available to be writed, less than uMinCount on timeout, <0 if error
+*/
+int32_t lFifoWaitWritable(Fifo_t *xpFifo, BufferSize_t uMinCount, uint32_t ulTimeout);
+
+#endif
+
 /*!
 	@brief Write data to fifo buffer
 	@param[in] xpFifo			FIFO descriptor
@@ -125,7 +204,7 @@ int32_t lFifoAvailableToWrite(Fifo_t *xpFifo);
 	@param[in] uCount			User data length
 	@return Writed bytes count
 */
-int32_t lFifoWrite(Fifo_t *xpFifo, const uint8_t *pucData, uint16_t uCount);
+int32_t lFifoWrite(Fifo_t *xpFifo, const uint8_t *pucData, BufferSize_t uCount);
 
 /*!
 	@brief Write data to fifo buffer
@@ -134,7 +213,7 @@ int32_t lFifoWrite(Fifo_t *xpFifo, const uint8_t *pucData, uint16_t uCount);
 	@param[in] uCount			User data length
 	@return Writed bytes count or -1 if data doesn't fits in stream buffer
 */
-int32_t lFifoWriteAll(Fifo_t *xpFifo, const uint8_t *pucData, uint16_t uCount);
+int32_t lFifoWriteAll(Fifo_t *xpFifo, const uint8_t *pucData, BufferSize_t uCount);
 
 /*!
 	@brief Fill fifo buffer with specified data
@@ -143,7 +222,7 @@ int32_t lFifoWriteAll(Fifo_t *xpFifo, const uint8_t *pucData, uint16_t uCount);
 	@param[in]uCount			Repeat times
 	@return Writed bytes count
 */
-int32_t lFifoFill(Fifo_t *xpFifo, uint8_t cFiller, uint16_t uCount);
+int32_t lFifoFill(Fifo_t *xpFifo, uint8_t cFiller, BufferSize_t uCount);
 
 /*!
 	@brief Fill fifo buffer with specified data
@@ -152,7 +231,7 @@ int32_t lFifoFill(Fifo_t *xpFifo, uint8_t cFiller, uint16_t uCount);
 	@param[in]ulCount			Repeat times
 	@return Writed bytes count or -1 if data doesn't fits in stream buffer
 */
-int32_t lFifoFillAll(Fifo_t *xpFifo, uint8_t cFiller, uint16_t uCount);
+int32_t lFifoFillAll(Fifo_t *xpFifo, uint8_t cFiller, BufferSize_t uCount);
 
 /*!
 	@brief Write data to fifo buffer till string terminator. Terminator included.
@@ -180,6 +259,44 @@ int32_t lFifoWriteStringAll(Fifo_t *xpFifo, const char *pcString);
 */
 uint8_t bFifoWriteByte(Fifo_t *xpFifo, uint8_t ucData);
 
+/*!
+	@brief Get contiguous free space to place data in directly, other writes fail till commit
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] uMinLen			Minimal required space length
+	@param[out] ppucOutBuffer	Pointer to the free space
+	@param[out] puOutLen		Contiguous free space length, optional
+	@return True if space reserved
+*/
+uint8_t bFifoWriteReserve(Fifo_t *xpFifo, BufferSize_t uMinLen, uint8_t **ppucOutBuffer, BufferSize_t *puOutLen);
+
+/*!
+	@brief Write data placed in reserved space
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] uCount			Placed data length
+	@return True if all data writed
+*/
+uint8_t bFifoWriteCommit(Fifo_t *xpFifo, BufferSize_t uCount);
+
+/*!
+	@brief Claim exact free space to place data in directly, safe for concurrent producers
+	       if buffer supports claims. Every claim must be published.
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] uCount			Space length, 0 only checks claims support
+	@param[out] apucSpans		Claimed space, continues from the second span when it wraps the buffer end
+	@param[out] pulTicket		Claim ticket to publish space with
+	@return First span length, <0 if claims are not supported or not enough free space
+*/
+int32_t lFifoWriteClaim(Fifo_t *xpFifo, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket);
+
+/*!
+	@brief Publish data placed in claimed space
+	@param[in] xpFifo			FIFO descriptor
+	@param[in] ulTicket			Claim ticket
+	@param[in] uCount			Claimed space length
+	@return True if published
+*/
+uint8_t bFifoWritePublish(Fifo_t *xpFifo, uint32_t ulTicket, BufferSize_t uCount);
+
 /*!
 	@brief Read data from fifo buffer
 	@param[in] xpFifo			FIFO descriptor
@@ -187,7 +304,7 @@ uint8_t bFifoWriteByte(Fifo_t *xpFifo, uint8_t ucData);
 	@param[in] uCount			Desired data count to be readed
 	@return Readed bytes count
 */
-int32_t lFifoRead(Fifo_t *xpFifo, uint8_t *pucOutBuf, uint16_t uCount);
+int32_t lFifoRead(Fifo_t *xpFifo, uint8_t *pucOutBuf, BufferSize_t uCount);
 
 /*!
 	@brief Read data from fifo buffer without shift
@@ -196,7 +313,15 @@ int32_t lFifoRead(Fifo_t *xpFifo, uint8_t *pucOutBuf, uint16_t uCount);
 	@param[in] uCount			Desired data count to be readed
 	@return Copyed bytes count
 */
-int32_t lFifoPeek(Fifo_t *xpFifo, uint8_t *pucOutBuf, uint16_t uCount);
+int32_t lFifoPeek(Fifo_t *xpFifo, uint8_t *pucOutBuf, BufferSize_t uCount);
+
+/*!
+	@brief Get readable data in place, spans cover the data head, release it with lFifoShift
+	@param[in] xpFifo			FIFO descriptor
+	@param[out] axSpans			Two contiguous data chunks, second one is empty if not needed
+	@return Bytes count covered by spans
+*/
+int32_t lFifoPeekSpans(Fifo_t *xpFifo, FifoSpan_t axSpans[2]);
 
 /*!
 	@brief Remove available data from fifo buffer
@@ -204,7 +329,14 @@ int32_t lFifoPeek(Fifo_t *xpFifo, uint8_t *pucOutBuf, uint16_t uCount);
 	@param[in] uCount			Data count to be removed
 	@return Removed bytes count
 */
-int32_t lFifoShift(Fifo_t *xpFifo, uint16_t uCount);
+int32_t lFifoShift(Fifo_t *xpFifo, BufferSize_t uCount);
+
+/*
+  Print functions pass formatted pieces to fifo write as they are produced.
+  If buffer supports claims, record is measured first and formatted into single claim,
+  so records of concurrent producers never interleave. Record which doesn't fit
+  free space is not writed at all then.
+*/
 
 /*!
 	@brief Write string representation of a float value
@@ -290,10 +422,14 @@ typedef BufferBase_t buffer_base_t;
 typedef BufferBaseBool_t buffer_base_bool_t;
 typedef BufferRead_t buffer_read_t;
 typedef BufferWrite_t buffer_write_t;
+typedef BufferReserve_t buffer_reserve_t;
+typedef BufferCommit_t buffer_commit_t;
+typedef BufferReadSpan_t buffer_read_span_t;
 
 typedef FifoPrintIntegerFlags_t fifo_print_integer_flags_t;
 typedef FifoIface_t fifo_iface_t;
 typedef FifoIfaceEx_t fifo_iface_ex_t;
+typedef FifoSpan_t fifo_span_t;
 typedef Fifo_t fifo_t;
 
 /*!
@@ -304,7 +440,7 @@ typedef Fifo_t fifo_t;
 	@param[in] double_bufferization Use double bufferization for usage fifo with in interrupts
 	@return !0 if init ok
 */
-uint8_t fifo_init(fifo_t *fifo, uint8_t *buffer, uint16_t size, uint8_t double_bufferization);
+uint8_t fifo_init(fifo_t *fifo, uint8_t *buffer, buffer_size_t size, uint8_t double_bufferization);
 
 /*!
 	@brief Validate fifo descriptor
@@ -327,6 +463,30 @@ int32_t fifo_available_to_read(fifo_t *fifo);
 */
 int32_t fifo_available_to_write(fifo_t *fifo);
 
+#ifdef CL_FIFO_WAIT
+
+/*!
+	@brief Block calling thread till data available, Linux only.
+	       Writers wake waiting threads, no syscalls made while nobody waits.
+	@param[in] fifo			FIFO descriptor
+	@param[in] min_count	Data bytes count to wait for
+	@param[in] timeout		Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout, 0 to poll
+	@return Bytes count available to be readed, less than min_count on timeout, <0 if error
+*/
+int32_t fifo_wait_readable(fifo_t *fifo, buffer_size_t min_count, uint32_t timeout);
+
+/*!
+	@brief Block calling thread till free space available, Linux only.
+	       Readers wake waiting threads, no syscalls made while nobody waits.
+	@param[in] fifo			FIFO descriptor
+	@param[in] min_count	Free space to wait for
+	@param[in] timeout		Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout, 0 to poll
+	@return Bytes count available to be writed, less than min_count on timeout, <0 if error
+*/
+int32_t fifo_wait_writable(fifo_t *fifo, buffer_size_t min_count, uint32_t timeout);
+
+#endif
+
 /*!
 	@brief Write data to fifo buffer
 	@param[in] fifo			FIFO descriptor
@@ -334,7 +494,7 @@ int32_t fifo_available_to_write(fifo_t *fifo);
 	@param[in] count		User data length
 	@return Writed bytes count
 */
-int32_t fifo_write(fifo_t *fifo, const uint8_t *data, uint16_t count);
+int32_t fifo_write(fifo_t *fifo, const uint8_t *data, buffer_size_t count);
 
 /*!
 	@brief Write data to fifo buffer
@@ -343,7 +503,7 @@ int32_t fifo_write(fifo_t *fifo, const uint8_t *data, uint16_t count);
 	@param[in] count		User data length
 	@return Writed bytes count or -1 if data doesn't fits in stream buffer
 */
-int32_t fifo_write_all(fifo_t *fifo, const uint8_t *data, uint16_t count);
+int32_t fifo_write_all(fifo_t *fifo, const uint8_t *data, buffer_size_t count);
 
 /*!
 	@brief Fill fifo buffer with specified data
@@ -352,7 +512,7 @@ int32_t fifo_write_all(fifo_t *fifo, const uint8_t *data, uint16_t count);
 	@param[in] count		Repeat times
 	@return Writed bytes count
 */
-int32_t fifo_fill(fifo_t *fifo, uint8_t filler, uint16_t count);
+int32_t fifo_fill(fifo_t *fifo, uint8_t filler, buffer_size_t count);
 
 /*!
 	@brief Fill fifo buffer with specified data
@@ -361,7 +521,7 @@ int32_t fifo_fill(fifo_t *fifo, uint8_t filler, uint16_t count);
 	@param[in] count		Repeat times
 	@return Writed bytes count or -1 if data doesn't fits in stream buffer
 */
-int32_t fifo_fill_all(fifo_t *fifo, uint8_t filler, uint16_t count);
+int32_t fifo_fill_all(fifo_t *fifo, uint8_t filler, buffer_size_t count);
 
 /*!
 	@brief Write data to fifo buffer till string terminator. Terminator included.
@@ -389,6 +549,44 @@ int32_t fifo_write_string_all(fifo_t *fifo, const char *string);
 */
 uint8_t fifo_write_byte(fifo_t *fifo, uint8_t data);
 
+/*!
+	@brief Get contiguous free space to place data in directly, other writes fail till commit
+	@param[in] fifo			FIFO descriptor
+	@param[in] min_len		Minimal required space length
+	@param[out] out_buffer	Pointer to the free space
+	@param[out] out_len		Contiguous free space length, optional
+	@return True if space reserved
+*/
+uint8_t fifo_write_reserve(fifo_t *fifo, buffer_size_t min_len, uint8_t **out_buffer, buffer_size_t *out_len);
+
+/*!
+	@brief Write data placed in reserved space
+	@param[in] fifo			FIFO descriptor
+	@param[in] count		Placed data length
+	@return True if all data writed
+*/
+uint8_t fifo_write_commit(fifo_t *fifo, buffer_size_t count);
+
+/*!
+	@brief Claim exact free space to place data in directly, safe for concurrent producers
+	       if buffer supports claims. Every claim must be published.
+	@param[in] fifo			FIFO descriptor
+	@param[in] count		Space length, 0 only checks claims support
+	@param[out] spans		Claimed space, continues from the second span when it wraps the buffer end
+	@param[out] ticket		Claim ticket to publish space with
+	@return First span length, <0 if claims are not supported or not enough free space
+*/
+int32_t fifo_write_claim(fifo_t *fifo, buffer_size_t count, uint8_t *spans[2], uint32_t *ticket);
+
+/*!
+	@brief Publish data placed in claimed space
+	@param[in] fifo			FIFO descriptor
+	@param[in] ticket		Claim ticket
+	@param[in] count		Claimed space length
+	@return True if published
+*/
+uint8_t fifo_write_publish(fifo_t *fifo, uint32_t ticket, buffer_size_t count);
+
 /*!
 	@brief Read data from fifo buffer
 	@param[in] fifo  FIFO descriptor
@@ -396,7 +594,7 @@ uint8_t fifo_write_byte(fifo_t *fifo, uint8_t data);
 	@param[in] count Desired data count to be readed
 	@return Readed bytes count
 */
-int32_t fifo_read(fifo_t *fifo, uint8_t *out_buf, uint16_t count);
+int32_t fifo_read(fifo_t *fifo, uint8_t *out_buf, buffer_size_t count);
 
 /*!
 	@brief Write string representation of a float value
@@ -439,7 +637,15 @@ static inline int32_t fifo_printf(fifo_t *fifo, const char* format, ...)  __attr
 	@param[in] count		Desired data count to be readed
 	@return Copyed bytes count
 */
-int32_t fifo_peek(fifo_t *fifo, uint8_t *out_buf, uint16_t count);
+int32_t fifo_peek(fifo_t *fifo, uint8_t *out_buf, buffer_size_t count);
+
+/*!
+	@brief Get readable data in place, spans cover the data head, release it with fifo_shift
+	@param[in] fifo			FIFO descriptor
+	@param[out] spans		Two contiguous data chunks, second one is empty if not needed
+	@return Bytes count covered by spans
+*/
+int32_t fifo_peek_spans(fifo_t *fifo, fifo_span_t spans[2]);
 
 /*!
 	@brief Remove available data from fifo buffer
@@ -447,7 +653,7 @@ int32_t fifo_peek(fifo_t *fifo, uint8_t *out_buf, uint16_t count);
 	@param[in] count			Data count to be removed
 	@return Removed bytes count
 */
-int32_t fifo_shift(fifo_t *fifo, uint16_t count);
+int32_t fifo_shift(fifo_t *fifo, buffer_size_t count);
 
 /*!
 	@brief Clear fifo buffer
@@ -0,0 +1,113 @@
+/*!
+    HashMap.h
+
+    Fixed capacity open addressing hash map with Robin Hood probing.
+    Slots storage is provided by caller, map keeps pointers to keys and values,
+    key memory must stay valid while the item is in the map.
+*/
+#ifndef HASH_MAP_H_INCLUDED
+#define HASH_MAP_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HASH_MAP_DESCRIPTOR_SIZE (2 * sizeof(void *) + 16)
+#define HASH_MAP_SLOT_SIZE       (2 * sizeof(void *) + 8)
+
+typedef struct {
+	CL_PRIVATE(HASH_MAP_DESCRIPTOR_SIZE);
+} HashMap_t;
+
+typedef struct {
+	CL_PRIVATE(HASH_MAP_SLOT_SIZE);
+} HashMapSlot_t;
+
+/*!
+	Key hash function, same signature as HashDjb2, HashSdbm, HashKnuth
+*/
+typedef uint32_t (*HashMapHash_t)(void *pxData, uint32_t ulSize);
+typedef void (*HashMapAction_t)(const void *pvKey, uint16_t usKeySize, void *pvValue, void *pvArg);
+
+/*!
+	@brief Initialize hash map
+	@param[in] pxMap           Map descriptor
+	@param[in] pxSlots         Slots storage
+	@param[in] ulCapacity      Slots count, power of 2 up to 65536, map holds up to 7/8 of it
+	@param[in] pfHash          Key hash function, HashDjb2 if libNULL
+	@return True if ok
+*/
+uint8_t bHashMapInit(HashMap_t *pxMap, HashMapSlot_t *pxSlots, uint32_t ulCapacity, HashMapHash_t pfHash);
+
+/*!
+	@brief Insert item or replace value of existing key
+	@param[in] pxMap           Map descriptor
+	@param[in] pvKey           Key pointer, referenced by map
+	@param[in] usKeySize       Key size
+	@param[in] pvValue         Value pointer
+	@return True if ok, false if map is full
+*/
+uint8_t bHashMapInsert(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize, void *pvValue);
+
+/*!
+	@brief Find value by key
+	@param[in] pxMap           Map descriptor
+	@param[in] pvKey           Key pointer
+	@param[in] usKeySize       Key size
+	@return Value pointer or libNULL if not found
+*/
+void *pvHashMapFind(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize);
+
+/*!
+	@brief Remove item by key
+	@param[in] pxMap           Map descriptor
+	@param[in] pvKey           Key pointer
+	@param[in] usKeySize       Key size
+	@return Removed value pointer or libNULL if not found
+*/
+void *pvHashMapRemove(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize);
+
+/*!
+	@brief Get items count
+	@param[in] pxMap           Map descriptor
+	@return Items count
+*/
+uint32_t ulHashMapCount(HashMap_t *pxMap);
+
+/*!
+	@brief Call action for every item, map must not be modified from action
+	@param[in] pxMap           Map descriptor
+	@param[in] pfAction        Action
+	@param[in] pvArg           Action argument
+	@return Items count
+*/
+uint32_t ulHashMapDoForeach(HashMap_t *pxMap, HashMapAction_t pfAction, void *pvArg);
+
+/*!
+	@brief Remove all items
+	@param[in] pxMap           Map descriptor
+*/
+void vHashMapClear(HashMap_t *pxMap);
+
+/*!
+  Snake notation
+*/
+
+typedef HashMap_t hash_map_t;
+typedef HashMapSlot_t hash_map_slot_t;
+typedef HashMapHash_t hash_map_hash_t;
+typedef HashMapAction_t hash_map_action_t;
+
+uint8_t hash_map_init(hash_map_t *map, hash_map_slot_t *slots, uint32_t capacity, hash_map_hash_t hash_fn);
+uint8_t hash_map_insert(hash_map_t *map, const void *key, uint16_t key_size, void *value);
+void *hash_map_find(hash_map_t *map, const void *key, uint16_t key_size);
+void *hash_map_remove(hash_map_t *map, const void *key, uint16_t key_size);
+uint32_t hash_map_count(hash_map_t *map);
+uint32_t hash_map_do_foreach(hash_map_t *map, hash_map_action_t action_fn, void *arg);
+void hash_map_clear(hash_map_t *map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HASH_MAP_H_INCLUDED */
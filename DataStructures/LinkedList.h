@@ -18,7 +18,7 @@ static inline void *__LinkedListCalcObjPtr(size_t llOffset, void *llPtr) { retur
 #define __LinkedListObject__                            LinkedListItem_t __ll;
 #define LinkedListItem(pxObj)                           (&((pxObj)->__ll))
 
-#define LL_ITEM_SIZE    16
+#define LL_ITEM_SIZE    (3 * sizeof(void *) + 4)
 
 	typedef struct LL_ITEM_T {
 		CL_PRIVATE(LL_ITEM_SIZE);
@@ -1,7 +1,7 @@
 #ifndef MEDIAN_FILTER_H_
 #define MEDIAN_FILTER_H_
 
-#define MEDIAN_FILTER_PRV    8
+#define MEDIAN_FILTER_PRV    (sizeof(void *) + 4)
 
 typedef struct {
   uint32_t *data;
@@ -20,7 +20,7 @@ void mem_set(void* dst, uint8_t val, size_t cnt);
 
 
 /* Compare memory block */
-int8_t mem_cmp(const void* dst, const void* src, size_t cnt);	/* ZR:same, NZ:different */
+int8_t mem_cmp(const void* dst, const void* src, size_t cnt);	/* ZR:same, <0: dst less, >0: dst greater */
 
 /* Move memory to memory */
 void mem_move(void* dst, const void* src, size_t cnt);
@@ -0,0 +1,178 @@
+/*!
+    MpscBuffer.h
+
+    Multiple producers single consumer lock-free buffer, fits as fifo buffer backend.
+    Writes of different producers never interleave, each write claims contiguous space
+    and is published in claim order. Only one consumer may read at a time.
+    Requires 32-bit atomic compare and exchange support, not intended for use from ISR:
+    producer publishing its data waits for producers claimed space before it.
+    If producers may be preempted between claim and publish (more threads than cores,
+    priority scheduling), define CL_MPSC_BUFFER_YIELD() to scheduler yield or delay,
+    or CL_MPSC_BUFFER_SCHED_YIELD to use POSIX sched_yield, waiting producer spins otherwise.
+*/
+#ifndef MPSC_BUFFER_H_INCLUDED
+#define MPSC_BUFFER_H_INCLUDED
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MPSC_BUFFER_DESCRIPTOR_SIZE 20
+
+typedef struct {
+	CL_PRIVATE(MPSC_BUFFER_DESCRIPTOR_SIZE);
+} MpscBuffer_t;
+
+/*!
+	@brief Initialize buffer, descriptor will be placed at the beginning of the buffer.
+	       Data space is the largest power of 2 that fits in the rest of buffer.
+	@param[in] pucBuffer            Buffer pointer
+	@param[in] uBufferSize          Buffer length
+	@return Pointer to buffer descriptor
+*/
+MpscBuffer_t *pxMpscBufferInit(uint8_t *pucBuffer, BufferSize_t uBufferSize);
+
+/*!
+	@brief Get published data count
+	@param[in] pxDescriptor			Buffer descriptor
+	@return Bytes count available to be readed
+*/
+int32_t lMpscBufferAvailable(MpscBuffer_t *pxDescriptor);
+
+/*!
+	@brief Get free space
+	@param[in] pxDescriptor			Buffer descriptor
+	@return Bytes count available to be writed
+*/
+int32_t lMpscBufferFree(MpscBuffer_t *pxDescriptor);
+
+/*!
+	@brief Moves data to user buffer, consumer only
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] pucDestBuf        Pointer to user buffer
+	@param[in] uCount            Desired data bytes count to be readed
+	@param[in] uSkip             Desired data bytes count to be skipped before reading
+	@param[in] bToPeek           If need not shift data from buffer
+	@return Copyed data bytes count
+*/
+int32_t lMpscBufferRead(MpscBuffer_t *pxDescriptor, uint8_t *pucDestBuf, BufferSize_t uCount, BufferSize_t uSkip, uint8_t bToPeek);
+
+/*!
+	@brief Write data to buffer, safe for concurrent producers
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] pucData           Pointer to user data buffer
+	@param[in] uCount            Desired data count to copy
+	@param[in] bFill             Will copy first byte from user data buffer uCount times
+	@param[in] bPutAll           Will copy all uCount data bytes or nothing
+	@param[in] bAsString         Will copy data bytes before uCount reached or string terminator found
+	@return Writed data bytes count
+*/
+int32_t lMpscBufferWrite(MpscBuffer_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFill, uint8_t bPutAll, uint8_t bAsString);
+
+/*!
+	@brief Claim exact space to place data in directly, safe for concurrent producers.
+	       Claimed space continues from the second span when it wraps the buffer end.
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] uCount            Space length
+	@param[out] apucSpans        Claimed space spans
+	@param[out] pulTicket        Claim ticket to publish space with
+	@return First span length, <0 if not enough free space
+*/
+int32_t lMpscBufferClaim(MpscBuffer_t *pxDescriptor, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket);
+
+/*!
+	@brief Publish claimed space, every claim must be published: waits for producers claimed space before
+	@param[in] pxDescriptor      Buffer descriptor
+	@param[in] ulTicket          Claim ticket
+	@param[in] uCount            Claimed space length
+*/
+void vMpscBufferPublish(MpscBuffer_t *pxDescriptor, uint32_t ulTicket, BufferSize_t uCount);
+
+/*!
+	@brief Flush published data, consumer only
+	@param[in] pxDescriptor			Buffer descriptor
+*/
+void vMpscBufferFlush(MpscBuffer_t *pxDescriptor);
+
+/*!
+  Snake notation
+*/
+
+typedef MpscBuffer_t mpsc_buffer_t;
+
+/*!
+	@brief Initialize buffer, descriptor will be placed at the beginning of the buffer.
+	       Data space is the largest power of 2 that fits in the rest of buffer.
+	@param[in] buffer            Buffer pointer
+	@param[in] buffer_size       Buffer length
+	@return Pointer to buffer descriptor
+*/
+mpsc_buffer_t *mpsc_buffer_init(uint8_t *buffer, buffer_size_t buffer_size);
+
+/*!
+	@brief Get published data count
+	@param[in] desc			Buffer descriptor
+	@return Bytes count available to be readed
+*/
+int32_t mpsc_buffer_available(mpsc_buffer_t *desc);
+
+/*!
+	@brief Get free space
+	@param[in] desc			Buffer descriptor
+	@return Bytes count available to be writed
+*/
+int32_t mpsc_buffer_free(mpsc_buffer_t *desc);
+
+/*!
+	@brief Moves data to user buffer, consumer only
+	@param[in] desc      Buffer descriptor
+	@param[in] dest      Pointer to user buffer
+	@param[in] count     Desired data bytes count to be readed
+	@param[in] skip      Desired data bytes count to be skipped before reading
+	@param[in] to_peek   If need not shift data from buffer
+	@return Copyed data bytes count
+*/
+int32_t mpsc_buffer_read(mpsc_buffer_t *desc, uint8_t *dest, buffer_size_t count, buffer_size_t skip, uint8_t to_peek);
+
+/*!
+	@brief Write data to buffer, safe for concurrent producers
+	@param[in] desc      Buffer descriptor
+	@param[in] data      Pointer to user data buffer
+	@param[in] count     Desired amount of data to copy
+	@param[in] to_fill   Will copy first byte from user data buffer <count> times
+	@param[in] put_all   Will copy all <count> data bytes or nothing
+	@param[in] as_string Will copy data bytes before <count> reached or string terminator found
+	@return Writed data bytes count
+*/
+int32_t mpsc_buffer_write(mpsc_buffer_t *desc, const uint8_t *data, buffer_size_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string);
+
+/*!
+	@brief Claim exact space to place data in directly, safe for concurrent producers.
+	       Claimed space continues from the second span when it wraps the buffer end.
+	@param[in] desc      Buffer descriptor
+	@param[in] count     Space length
+	@param[out] spans    Claimed space spans
+	@param[out] ticket   Claim ticket to publish space with
+	@return First span length, <0 if not enough free space
+*/
+int32_t mpsc_buffer_claim(mpsc_buffer_t *desc, buffer_size_t count, uint8_t *spans[2], uint32_t *ticket);
+
+/*!
+	@brief Publish claimed space, every claim must be published: waits for producers claimed space before
+	@param[in] desc      Buffer descriptor
+	@param[in] ticket    Claim ticket
+	@param[in] count     Claimed space length
+*/
+void mpsc_buffer_publish(mpsc_buffer_t *desc, uint32_t ticket, buffer_size_t count);
+
+/*!
+	@brief Flush published data, consumer only
+	@param[in] desc			Buffer descriptor
+*/
+void mpsc_buffer_flush(mpsc_buffer_t *desc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPSC_BUFFER_H_INCLUDED */
@@ -37,11 +37,12 @@ static inline int32_t usScbAvailableFree(SimpleCircularBuffer_t *pxBuf) {
 }
 
 static inline int32_t usScbNonSegmentedAvailable(SimpleCircularBuffer_t *pxBuf) {
-  return (pxBuf->usHead >= pxBuf->usTail)? (pxBuf->usHead - pxBuf->usTail): (pxBuf->usMax - pxBuf->usTail);
+  return (pxBuf->usHead >= pxBuf->usTail)? (pxBuf->usHead - pxBuf->usTail): (pxBuf->usMax - pxBuf->usTail + 1);
 }
 
 static inline int32_t usScbNonSegmentedAvailableFree(SimpleCircularBuffer_t *pxBuf) {
-  return (pxBuf->usHead >= pxBuf->usTail)? (pxBuf->usMax - pxBuf->usHead): (pxBuf->usTail - pxBuf->usHead);
+  /* One cell stays free to distinguish full buffer, it is the last one only when tail is at the start */
+  return (pxBuf->usHead >= pxBuf->usTail)? (pxBuf->usMax - pxBuf->usHead + (pxBuf->usTail != 0)): (pxBuf->usTail - pxBuf->usHead - 1);
 }
 
 static inline void vScbMoveTail(SimpleCircularBuffer_t *pxBuf, uint16_t usCount) {
@@ -82,18 +83,125 @@ static inline uint8_t bScbPop(SimpleCircularBuffer_t *pxBuf, uint8_t *pucOutData
   return 0;
 }
 
+/*!
+  Zero-copy write: place data at the returned pointer, then commit it
+*/
+static inline int32_t lScbWriteReserve(SimpleCircularBuffer_t *pxBuf, uint8_t **ppucBuffer) {
+  *ppucBuffer = pucScbBuffer(pxBuf);
+  return usScbNonSegmentedAvailableFree(pxBuf);
+}
+
+static inline int32_t lScbWriteCommit(SimpleCircularBuffer_t *pxBuf, uint16_t usCount) {
+  uint16_t cnt = usScbNonSegmentedAvailableFree(pxBuf);
+  cnt = CL_MIN(cnt, usCount);
+  pxBuf->usHead = (pxBuf->usHead + cnt) & pxBuf->usMax;
+  return cnt;
+}
+
 static int32_t _lScbRead(SimpleCircularBuffer_t *pxBuf, uint8_t *pucBuf, uint16_t usSize) {
-  int32_t i = usSize;
-  while(i && bScbPop(pxBuf, pucBuf++))
-    i--;
-  return usSize - i;
+  uint16_t cnt = usScbAvailable(pxBuf);
+  cnt = CL_MIN(cnt, usSize);
+  uint16_t chunk = CL_MIN(cnt, pxBuf->usMax + 1 - pxBuf->usTail);
+  mem_cpy(pucBuf, pxBuf->pucBuffer + pxBuf->usTail, chunk);
+  mem_cpy(pucBuf + chunk, pxBuf->pucBuffer, cnt - chunk);
+  pxBuf->usTail = (pxBuf->usTail + cnt) & pxBuf->usMax;
+  return cnt;
 }
 
 static int32_t _lScbWrite(SimpleCircularBuffer_t *pxBuf, const uint8_t *pucData, uint16_t len) {
-  int32_t i = len;
-  while(i && bScbPush(pxBuf, *pucData++))
-    i--;
-  return len - i;
+  uint16_t cnt = usScbAvailableFree(pxBuf);
+  cnt = CL_MIN(cnt, len);
+  uint16_t chunk = CL_MIN(cnt, pxBuf->usMax + 1 - pxBuf->usHead);
+  mem_cpy(pxBuf->pucBuffer + pxBuf->usHead, pucData, chunk);
+  mem_cpy(pxBuf->pucBuffer, pucData + chunk, cnt - chunk);
+  pxBuf->usHead = (pxBuf->usHead + cnt) & pxBuf->usMax;
+  return cnt;
+}
+
+/*!
+  Single producer single consumer variant, safe for one writer and one reader running concurrently.
+  Producer and consumer indices are kept on separate cache lines, each side caches
+  the other side index and reloads it only when the cached value limits the operation.
+  Note: buffer size must be power of 2
+*/
+typedef struct {
+  uint8_t *pucBuffer;
+  uint16_t usMax;
+  struct {
+    uint16_t usHead;
+    uint16_t usTailCache;
+  } xProducer __attribute__ ((aligned (CL_CACHE_LINE_SIZE)));
+  struct {
+    uint16_t usTail;
+    uint16_t usHeadCache;
+  } xConsumer __attribute__ ((aligned (CL_CACHE_LINE_SIZE)));
+} SpscCircularBuffer_t;
+
+static inline void vScbSpscInit(SpscCircularBuffer_t *pxBuf, uint8_t *pucBuffer, uint16_t usSize) {
+  pxBuf->xProducer.usHead = pxBuf->xProducer.usTailCache = 0;
+  pxBuf->xConsumer.usTail = pxBuf->xConsumer.usHeadCache = 0;
+  pxBuf->usMax = usSize - 1;
+  pxBuf->pucBuffer = pucBuffer;
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/* Consumer side */
+static inline int32_t lScbSpscAvailable(SpscCircularBuffer_t *pxBuf) {
+  uint16_t head = __atomic_load_n(&pxBuf->xProducer.usHead, __ATOMIC_ACQUIRE);
+  pxBuf->xConsumer.usHeadCache = head;
+  return (head - pxBuf->xConsumer.usTail) & pxBuf->usMax;
+}
+
+/* Producer side */
+static inline int32_t lScbSpscAvailableFree(SpscCircularBuffer_t *pxBuf) {
+  uint16_t tail = __atomic_load_n(&pxBuf->xConsumer.usTail, __ATOMIC_ACQUIRE);
+  pxBuf->xProducer.usTailCache = tail;
+  return (tail - pxBuf->xProducer.usHead - 1) & pxBuf->usMax;
+}
+
+static inline uint8_t bScbSpscPush(SpscCircularBuffer_t *pxBuf, uint8_t ucData) {
+  uint16_t head = pxBuf->xProducer.usHead;
+  uint16_t next = (head + 1) & pxBuf->usMax;
+  if((next == pxBuf->xProducer.usTailCache) && !lScbSpscAvailableFree(pxBuf))
+    return 0;
+  pxBuf->pucBuffer[head] = ucData;
+  __atomic_store_n(&pxBuf->xProducer.usHead, next, __ATOMIC_RELEASE);
+  return 1;
+}
+
+static inline uint8_t bScbSpscPop(SpscCircularBuffer_t *pxBuf, uint8_t *pucOutData) {
+  uint16_t tail = pxBuf->xConsumer.usTail;
+  if((tail == pxBuf->xConsumer.usHeadCache) && !lScbSpscAvailable(pxBuf))
+    return 0;
+  if(pucOutData) *pucOutData = pxBuf->pucBuffer[tail];
+  __atomic_store_n(&pxBuf->xConsumer.usTail, (tail + 1) & pxBuf->usMax, __ATOMIC_RELEASE);
+  return 1;
+}
+
+static int32_t _lScbSpscRead(SpscCircularBuffer_t *pxBuf, uint8_t *pucBuf, uint16_t usSize) {
+  uint16_t tail = pxBuf->xConsumer.usTail;
+  uint16_t cnt = (pxBuf->xConsumer.usHeadCache - tail) & pxBuf->usMax;
+  if(cnt < usSize)
+    cnt = lScbSpscAvailable(pxBuf);
+  cnt = CL_MIN(cnt, usSize);
+  uint16_t chunk = CL_MIN(cnt, pxBuf->usMax + 1 - tail);
+  mem_cpy(pucBuf, pxBuf->pucBuffer + tail, chunk);
+  mem_cpy(pucBuf + chunk, pxBuf->pucBuffer, cnt - chunk);
+  __atomic_store_n(&pxBuf->xConsumer.usTail, (tail + cnt) & pxBuf->usMax, __ATOMIC_RELEASE);
+  return cnt;
+}
+
+static int32_t _lScbSpscWrite(SpscCircularBuffer_t *pxBuf, const uint8_t *pucData, uint16_t len) {
+  uint16_t head = pxBuf->xProducer.usHead;
+  uint16_t cnt = (pxBuf->xProducer.usTailCache - head - 1) & pxBuf->usMax;
+  if(cnt < len)
+    cnt = lScbSpscAvailableFree(pxBuf);
+  cnt = CL_MIN(cnt, len);
+  uint16_t chunk = CL_MIN(cnt, pxBuf->usMax + 1 - head);
+  mem_cpy(pxBuf->pucBuffer + head, pucData, chunk);
+  mem_cpy(pxBuf->pucBuffer, pucData + chunk, cnt - chunk);
+  __atomic_store_n(&pxBuf->xProducer.usHead, (head + cnt) & pxBuf->usMax, __ATOMIC_RELEASE);
+  return cnt;
 }
 
 
@@ -136,12 +244,41 @@ static inline uint8_t scb_push(simple_circular_buffer_t *, uint8_t)\
 static inline uint8_t scb_pop(simple_circular_buffer_t *, uint8_t *)\
                                                       __attribute__ ((alias ("bScbPop")));
 
+static inline int32_t scb_write_reserve(simple_circular_buffer_t *, uint8_t **)\
+                                                      __attribute__ ((alias ("lScbWriteReserve")));
+
+static inline int32_t scb_write_commit(simple_circular_buffer_t *, uint16_t)\
+                                                      __attribute__ ((alias ("lScbWriteCommit")));
+
 static int32_t scb_read(simple_circular_buffer_t *, uint8_t *, uint16_t)\
                                                       __attribute__ ((alias ("_lScbRead")));
 
 static int32_t scb_write(simple_circular_buffer_t *, const uint8_t *, uint16_t)\
                                                       __attribute__ ((alias ("_lScbWrite")));
 
+typedef SpscCircularBuffer_t spsc_circular_buffer_t;
+
+static inline void scb_spsc_init(spsc_circular_buffer_t *, uint8_t *, uint16_t)\
+                                                      __attribute__ ((alias ("vScbSpscInit")));
+
+static inline int32_t scb_spsc_available(spsc_circular_buffer_t *)\
+                                                      __attribute__ ((alias ("lScbSpscAvailable")));
+
+static inline int32_t scb_spsc_available_free(spsc_circular_buffer_t *)\
+                                                      __attribute__ ((alias ("lScbSpscAvailableFree")));
+
+static inline uint8_t scb_spsc_push(spsc_circular_buffer_t *, uint8_t)\
+                                                      __attribute__ ((alias ("bScbSpscPush")));
+
+static inline uint8_t scb_spsc_pop(spsc_circular_buffer_t *, uint8_t *)\
+                                                      __attribute__ ((alias ("bScbSpscPop")));
+
+static int32_t scb_spsc_read(spsc_circular_buffer_t *, uint8_t *, uint16_t)\
+                                                      __attribute__ ((alias ("_lScbSpscRead")));
+
+static int32_t scb_spsc_write(spsc_circular_buffer_t *, const uint8_t *, uint16_t)\
+                                                      __attribute__ ((alias ("_lScbSpscWrite")));
+
 #ifdef __cplusplus
 }
 #endif
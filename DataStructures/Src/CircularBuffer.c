@@ -1,6 +1,15 @@
 #include "CodeLib.h"
 
 #define CB_VALIDATION_NUMBER 0xCCB5
+#define CB_INDEX_NONE        ((BufferSize_t)-1)
+#define CB_PTRS_NONE         ((_CircularBufferPtrs_t)-1)
+
+/* tail and head pair, updated with a single access on 32-bit targets only with narrow index */
+#ifdef CL_CIRCULAR_BUFFER_WIDE_INDEX
+typedef uint64_t __attribute__ ((aligned (4), may_alias)) _CircularBufferPtrs_t;
+#else
+typedef uint32_t __attribute__ ((may_alias)) _CircularBufferPtrs_t;
+#endif
 
 /*
   Warning! Don't change fields order.
@@ -11,11 +20,11 @@
   - bCircularBufferCommitState
  */
 typedef struct {
-	uint16_t tail;
-	uint16_t head;
-	uint16_t tailBackup;
-	uint16_t headBackup;
-	uint16_t size;
+	BufferSize_t tail;
+	BufferSize_t head;
+	BufferSize_t tailBackup;
+	BufferSize_t headBackup;
+	BufferSize_t size;
 	uint16_t validation;
 	uint8_t buffer[];
 }_CircularBuffer_t;
@@ -23,17 +32,42 @@ typedef struct {
 LIB_ASSERRT_STRUCTURE_CAST(_CircularBuffer_t, CircularBuffer_t, CIRCULAR_BUFFER_DESCRIPTOR_SIZE, "CircularBuffer.h");
 
 static _CircularBuffer_t *_pxCircularBufferCastDescriptor(CircularBuffer_t *pxDescriptor) {
-	uint32_t ptr_align = (uint32_t)pxDescriptor;
+	size_t ptr_align = (size_t)pxDescriptor;
 	ptr_align = (((ptr_align + 3) >> 2) << 2);
 	_CircularBuffer_t *desc = (_CircularBuffer_t *)ptr_align;
 	return ((desc == libNULL) || (desc->validation != CB_VALIDATION_NUMBER))? libNULL: desc;
 }
 
-static void _vCircularBufferGetWrPtrs(_CircularBuffer_t *pxDescriptor, uint16_t *uOutTail, uint16_t *uOutHead) {
+/* Short segments are copied in place, call overhead dominates them */
+#define CB_SHORT_SEGMENT     8
+
+static inline void _vCircularBufferCopy(uint8_t *pucDst, const uint8_t *pucSrc, BufferSize_t uCount) {
+	if (uCount < CB_SHORT_SEGMENT) {
+		while (uCount--) {
+			*pucDst++ = *pucSrc++;
+		}
+	}
+	else {
+		mem_cpy(pucDst, pucSrc, uCount);
+	}
+}
+
+static inline void _vCircularBufferSet(uint8_t *pucDst, uint8_t ucVal, BufferSize_t uCount) {
+	if (uCount < CB_SHORT_SEGMENT) {
+		while (uCount--) {
+			*pucDst++ = ucVal;
+		}
+	}
+	else {
+		mem_set(pucDst, ucVal, uCount);
+	}
+}
+
+static void _vCircularBufferGetWrPtrs(_CircularBuffer_t *pxDescriptor, BufferSize_t *uOutTail, BufferSize_t *uOutHead) {
 	*uOutTail = pxDescriptor->tail;
 	*uOutHead = pxDescriptor->head;
-	if (pxDescriptor->tailBackup != 0xFFFF) {
-		if (pxDescriptor->headBackup == 0xFFFF) {
+	if (pxDescriptor->tailBackup != CB_INDEX_NONE) {
+		if (pxDescriptor->headBackup == CB_INDEX_NONE) {
 			*uOutHead = pxDescriptor->headBackup;
 			return;
 		}
@@ -44,52 +78,53 @@ static void _vCircularBufferGetWrPtrs(_CircularBuffer_t *pxDescriptor, uint16_t
 	}
 }
 
-CircularBuffer_t *pxCircularBufferInit(uint8_t *pucBuffer, uint16_t uBufferSize) {
+CircularBuffer_t *pxCircularBufferInit(uint8_t *pucBuffer, BufferSize_t uBufferSize) {
 	if ((uBufferSize < (sizeof(CircularBuffer_t) + 3)) || (pucBuffer == libNULL)) return libNULL;
-	uint32_t ptr_align = (uint32_t)pucBuffer;
+	size_t ptr_align = (size_t)pucBuffer;
 	ptr_align = (((ptr_align + 3) >> 2) << 2);
 	_CircularBuffer_t *desc = (_CircularBuffer_t *)ptr_align;
-	uBufferSize -= ptr_align - (uint32_t)pucBuffer;
+	uBufferSize -= ptr_align - (size_t)pucBuffer;
 	desc->head = desc->tail = 0;
-	desc->headBackup = desc->tailBackup = 0xFFFF;
+	desc->headBackup = desc->tailBackup = CB_INDEX_NONE;
 	desc->size = uBufferSize - sizeof(CircularBuffer_t);
 	desc->validation = CB_VALIDATION_NUMBER;
 	return (CircularBuffer_t *)desc;
 }
 
+static inline BufferSize_t _uCircularBufferDataCount(_CircularBuffer_t *pxDescriptor) {
+	if (pxDescriptor->head == CB_INDEX_NONE) return pxDescriptor->size;
+	return (pxDescriptor->head >= pxDescriptor->tail)? (pxDescriptor->head - pxDescriptor->tail):
+		((pxDescriptor->size - pxDescriptor->tail) + pxDescriptor->head);
+}
+
 int32_t lCircularBufferAvailable(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
-	int32_t av = -1;
-	if (desc != libNULL) {
-		if (desc->head == 0xFFFF) av = desc->size;
-		else av = ((desc->head >= desc->tail)? (desc->head - desc->tail): ((desc->size - desc->tail) + desc->head));
-	}
-	return av;
+	return (desc != libNULL)? (int32_t)_uCircularBufferDataCount(desc): -1;
 }
 
 int32_t lCircularBufferFree(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	int32_t av = -1;
 	if (desc != libNULL) {
-		uint16_t tail, head;
+		BufferSize_t tail, head;
 		_vCircularBufferGetWrPtrs(desc, &tail, &head);
-		if (head == 0xFFFF) av = 0;
+		if (head == CB_INDEX_NONE) av = 0;
 		else av = (head < tail)? (tail - head) : ((desc->size - head) + tail);
 	}
 	return av;
 }
 
-int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucOutBuf, uint16_t uCount, uint16_t uSkip, uint8_t bPeek) {
+int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucOutBuf, BufferSize_t uCount, BufferSize_t uSkip, uint8_t bPeek) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc == libNULL || pucOutBuf == libNULL) {
 		return -1;
 	}
-	int32_t res = 0;
-	int32_t dataCount = lCircularBufferAvailable(pxDescriptor);
+	BufferSize_t res = 0;
+	BufferSize_t dataCount = _uCircularBufferDataCount(desc);
 	if ((uSkip || uCount) && dataCount) {
-		uint16_t tail = desc->tail;
-		uint16_t head = desc->head;
-		if (head == 0xFFFF) {
+		BufferSize_t tail = desc->tail;
+		BufferSize_t head = desc->head;
+		if (head == CB_INDEX_NONE) {
 			head = tail;
 		}
 		if (uSkip) {
@@ -103,13 +138,20 @@ int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucOutBuf,
 			dataCount -= uSkip;
 		}
 		if (uCount && dataCount) {
-			do {
-				*pucOutBuf++ = desc->buffer[tail++];
+			/* Data occupies at most two contiguous segments: [tail, size) and [0, head) */
+			res = CL_MIN(uCount, dataCount);
+			BufferSize_t chunk = CL_MIN(res, desc->size - tail);
+			_vCircularBufferCopy(pucOutBuf, &desc->buffer[tail], chunk);
+			if (chunk < res) {
+				_vCircularBufferCopy(pucOutBuf + chunk, desc->buffer, res - chunk);
+				tail = res - chunk;
+			}
+			else {
+				tail += chunk;
 				if (tail >= desc->size) {
 					tail = 0;
 				}
-				res++;
-			} while (res != uCount && tail != head);
+			}
 		}
 		res += uSkip;
 		if (!bPeek) {
@@ -120,38 +162,114 @@ int32_t lCircularBufferRead(CircularBuffer_t *pxDescriptor, uint8_t *pucOutBuf,
 	return res;
 }
 
-int32_t lCircularBufferWrite(CircularBuffer_t *pxDescriptor, const uint8_t *pucData, uint16_t uCount, uint8_t bFillMode, uint8_t bAllOrNothing, uint8_t bStringMode) {
+int32_t lCircularBufferReadSpan(CircularBuffer_t *pxDescriptor, BufferSize_t uSkip, const uint8_t **ppucSpan) {
+	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL || ppucSpan == libNULL) {
+		return -1;
+	}
+	BufferSize_t count = _uCircularBufferDataCount(desc);
+	*ppucSpan = libNULL;
+	if (count > uSkip) {
+		BufferSize_t pos = desc->tail + uSkip;
+		if (pos >= desc->size) {
+			pos -= desc->size;
+		}
+		*ppucSpan = &desc->buffer[pos];
+		return CL_MIN(count - uSkip, desc->size - pos);
+	}
+	return 0;
+}
+
+static BufferSize_t _uCircularBufferStrLen(const uint8_t *pucData, BufferSize_t uMax) {
+	BufferSize_t len = 0;
+	while ((len < uMax) && (pucData[len] != '\0')) {
+		len++;
+	}
+	return len;
+}
+
+int32_t lCircularBufferWrite(CircularBuffer_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFillMode, uint8_t bAllOrNothing, uint8_t bStringMode) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc == libNULL || pucData == libNULL) {
 		return -1;
 	}
-	int32_t res = 0;
+	BufferSize_t res = 0;
 	if (uCount != 0) {
-		uint16_t tail, head;
+		BufferSize_t tail, head;
 		_vCircularBufferGetWrPtrs(desc, &tail, &head);
-		while ((res != uCount) && (head != 0xFFFF)) {
-			if ((bStringMode) && (*pucData == '\0')) {
-				uCount = res;
-				break;
+		if (head != CB_INDEX_NONE) {
+			BufferSize_t space = (head < tail)? (tail - head) : ((desc->size - head) + tail);
+			res = CL_MIN(uCount, space);
+			if (bStringMode) {
+				/* Terminator is not copied, it ends the request */
+				BufferSize_t len = bFillMode? ((*pucData == '\0')? 0U: res): _uCircularBufferStrLen(pucData, res);
+				if (len < res) {
+					uCount = res = len;
+				}
+			}
+			/* Free space occupies at most two contiguous segments: [head, size) and [0, tail) */
+			BufferSize_t chunk = CL_MIN(res, desc->size - head);
+			if (bFillMode) {
+				_vCircularBufferSet(&desc->buffer[head], *pucData, chunk);
+				if (chunk < res) {
+					_vCircularBufferSet(desc->buffer, *pucData, res - chunk);
+				}
 			}
-			desc->buffer[head++] = *pucData;
-			res++;
+			else {
+				_vCircularBufferCopy(&desc->buffer[head], pucData, chunk);
+				if (chunk < res) {
+					_vCircularBufferCopy(desc->buffer, pucData + chunk, res - chunk);
+				}
+			}
+			head = (res == chunk)? (head + chunk): (res - chunk);
 			if (head >= desc->size) {
 				head = 0;
 			}
-			if (head == tail) {
-				head = 0xFFFF;
-			}
-			if (!bFillMode) {
-				pucData++;
+			if ((res != 0) && (head == tail)) {
+				head = CB_INDEX_NONE;
 			}
 		}
-		if (!bAllOrNothing || uCount == res) {
-			desc->head = head;
+		if (bAllOrNothing && (uCount != res)) {
+			return -1;
 		}
-		else {
-			res = -1;
+		desc->head = head;
+	}
+	return res;
+}
+
+static BufferSize_t _uCircularBufferWrContiguous(_CircularBuffer_t *pxDescriptor, BufferSize_t *puOutTail, BufferSize_t *puOutHead) {
+	_vCircularBufferGetWrPtrs(pxDescriptor, puOutTail, puOutHead);
+	if (*puOutHead == CB_INDEX_NONE) return 0;
+	return (*puOutHead < *puOutTail)? (*puOutTail - *puOutHead): (pxDescriptor->size - *puOutHead);
+}
+
+int32_t lCircularBufferWriteReserve(CircularBuffer_t *pxDescriptor, uint8_t **ppucBuffer) {
+	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL || ppucBuffer == libNULL) {
+		return -1;
+	}
+	BufferSize_t tail, head;
+	BufferSize_t len = _uCircularBufferWrContiguous(desc, &tail, &head);
+	*ppucBuffer = (len > 0)? &desc->buffer[head]: libNULL;
+	return len;
+}
+
+int32_t lCircularBufferWriteCommit(CircularBuffer_t *pxDescriptor, BufferSize_t uCount) {
+	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL) {
+		return -1;
+	}
+	BufferSize_t tail, head;
+	BufferSize_t res = CL_MIN(uCount, _uCircularBufferWrContiguous(desc, &tail, &head));
+	if (res > 0) {
+		head += res;
+		if (head >= desc->size) {
+			head = 0;
+		}
+		if (head == tail) {
+			head = CB_INDEX_NONE;
 		}
+		desc->head = head;
 	}
 	return res;
 }
@@ -159,13 +277,13 @@ int32_t lCircularBufferWrite(CircularBuffer_t *pxDescriptor, const uint8_t *pucD
 void vCircularBufferFlush(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc != libNULL) {
-		if (desc->tailBackup == 0xFFFF) {
-			*(((uint32_t *)pxDescriptor)) = 0;
+		if (desc->tailBackup == CB_INDEX_NONE) {
+			*(((_CircularBufferPtrs_t *)pxDescriptor)) = 0;
 		}
 		else {
-			if (desc->headBackup != 0xFFFF) {
-				uint32_t val = (((uint32_t)desc->headBackup) << 16) | desc->headBackup;
-				*((uint32_t *)pxDescriptor) = val;
+			if (desc->headBackup != CB_INDEX_NONE) {
+				_CircularBufferPtrs_t val = (((_CircularBufferPtrs_t)desc->headBackup) << (sizeof(BufferSize_t) * 8)) | desc->headBackup;
+				*((_CircularBufferPtrs_t *)pxDescriptor) = val;
 			}
 			else {
 				desc->tail = desc->head;
@@ -177,8 +295,8 @@ void vCircularBufferFlush(CircularBuffer_t *pxDescriptor) {
 uint8_t bCircularBufferBackup(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc != libNULL) {
-		if (desc->tailBackup == 0xFFFF) {
-			*(((uint32_t *)pxDescriptor) + 1) = *((uint32_t *)pxDescriptor);
+		if (desc->tailBackup == CB_INDEX_NONE) {
+			*(((_CircularBufferPtrs_t *)pxDescriptor) + 1) = *((_CircularBufferPtrs_t *)pxDescriptor);
 			return 1;
 		}
 	}
@@ -188,9 +306,9 @@ uint8_t bCircularBufferBackup(CircularBuffer_t *pxDescriptor) {
 uint8_t bCircularBufferRestore(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc != libNULL) {
-		if (desc->tailBackup != 0xFFFF) {
-			*((uint32_t *)pxDescriptor) = *(((uint32_t *)pxDescriptor) + 1);
-			*(((uint32_t *)pxDescriptor) + 1) = 0xFFFFFFFF;
+		if (desc->tailBackup != CB_INDEX_NONE) {
+			*((_CircularBufferPtrs_t *)pxDescriptor) = *(((_CircularBufferPtrs_t *)pxDescriptor) + 1);
+			*(((_CircularBufferPtrs_t *)pxDescriptor) + 1) = CB_PTRS_NONE;
 			return 1;
 		}
 	}
@@ -200,8 +318,8 @@ uint8_t bCircularBufferRestore(CircularBuffer_t *pxDescriptor) {
 uint8_t bCircularBufferCommit(CircularBuffer_t *pxDescriptor) {
 	_CircularBuffer_t *desc = _pxCircularBufferCastDescriptor(pxDescriptor);
 	if (desc != libNULL) {
-		if (desc->tailBackup != 0xFFFF) {
-			*(((uint32_t *)pxDescriptor) + 1) = 0xFFFFFFFF;
+		if (desc->tailBackup != CB_INDEX_NONE) {
+			*(((_CircularBufferPtrs_t *)pxDescriptor) + 1) = CB_PTRS_NONE;
 			return 1;
 		}
 	}
@@ -209,11 +327,14 @@ uint8_t bCircularBufferCommit(CircularBuffer_t *pxDescriptor) {
 }
 
 
-circular_buffer_t *circular_buffer_init(uint8_t *buffer, uint16_t buffer_size) __attribute__ ((alias ("pxCircularBufferInit")));
+circular_buffer_t *circular_buffer_init(uint8_t *buffer, BufferSize_t buffer_size) __attribute__ ((alias ("pxCircularBufferInit")));
 int32_t circular_buffer_available(circular_buffer_t *desc) __attribute__ ((alias ("lCircularBufferAvailable")));
 int32_t circular_buffer_free(circular_buffer_t *desc) __attribute__ ((alias ("lCircularBufferFree")));
-int32_t circular_buffer_read(circular_buffer_t *desc, uint8_t *dest, uint16_t count, uint16_t skip, uint8_t to_peek) __attribute__ ((alias ("lCircularBufferRead")));
-int32_t circular_buffer_write(circular_buffer_t *desc, const uint8_t *data, uint16_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string) __attribute__ ((alias ("lCircularBufferWrite")));
+int32_t circular_buffer_read(circular_buffer_t *desc, uint8_t *dest, BufferSize_t count, BufferSize_t skip, uint8_t to_peek) __attribute__ ((alias ("lCircularBufferRead")));
+int32_t circular_buffer_write(circular_buffer_t *desc, const uint8_t *data, BufferSize_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string) __attribute__ ((alias ("lCircularBufferWrite")));
+int32_t circular_buffer_read_span(circular_buffer_t *desc, BufferSize_t skip, const uint8_t **span) __attribute__ ((alias ("lCircularBufferReadSpan")));
+int32_t circular_buffer_write_reserve(circular_buffer_t *desc, uint8_t **buffer) __attribute__ ((alias ("lCircularBufferWriteReserve")));
+int32_t circular_buffer_write_commit(circular_buffer_t *desc, BufferSize_t count) __attribute__ ((alias ("lCircularBufferWriteCommit")));
 uint8_t circular_buffer_backup(circular_buffer_t *desc) __attribute__ ((alias ("bCircularBufferBackup")));
 uint8_t circular_buffer_restore(circular_buffer_t *desc) __attribute__ ((alias ("bCircularBufferRestore")));
 uint8_t circular_buffer_commit(circular_buffer_t *desc) __attribute__ ((alias ("bCircularBufferCommit")));
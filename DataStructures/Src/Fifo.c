@@ -2,29 +2,193 @@
 
 #define FIFO_VALIDATION_MARKER    ((uint16_t)(0xCBAF))
 
+/*
+  Buffer methods binding. CL_FIFO_STATIC_CIRCULAR_BUFFER binds circular buffer methods
+  at compile time, fifo interfaces are not used then. CL_FIFO_IS_IN_ISR() replaces pfIsInIsr.
+ */
+#ifdef CL_FIFO_STATIC_CIRCULAR_BUFFER
+#define _FIFO_IFACE(desc, method)               _FIFO_STATIC_##method
+#define _FIFO_IFACE_EX(desc, method)            _FIFO_STATIC_##method
+#define _FIFO_HAS_IFACE_EX(desc, method)        CL_TRUE
+#define _FIFO_STATIC_pfBufferInit               pxCircularBufferInit
+#define _FIFO_STATIC_pfBufferAvailable          lCircularBufferAvailable
+#define _FIFO_STATIC_pfBufferFree               lCircularBufferFree
+#define _FIFO_STATIC_pfBufferFlush              vCircularBufferFlush
+#define _FIFO_STATIC_pfBufferRead               lCircularBufferRead
+#define _FIFO_STATIC_pfBufferWrite              lCircularBufferWrite
+#define _FIFO_STATIC_pfBufferBackup             bCircularBufferBackup
+#define _FIFO_STATIC_pfBufferCommit             bCircularBufferCommit
+#define _FIFO_STATIC_pfBufferRestore            bCircularBufferRestore
+#define _FIFO_STATIC_pfBufferWriteReserve       lCircularBufferWriteReserve
+#define _FIFO_STATIC_pfBufferWriteCommit        lCircularBufferWriteCommit
+#define _FIFO_STATIC_pfBufferReadSpan           lCircularBufferReadSpan
+#else
+#define _FIFO_IFACE(desc, method)               (desc)->pxIface->method
+#define _FIFO_IFACE_EX(desc, method)            (desc)->pxIfaceEx->method
+#define _FIFO_HAS_IFACE_EX(desc, method)        (((desc)->pxIfaceEx != libNULL) && ((desc)->pxIfaceEx->method != libNULL))
+#endif
+
+#ifdef CL_FIFO_IS_IN_ISR
+#define _FIFO_IS_IN_ISR(desc)                   (CL_FIFO_IS_IN_ISR())
+#else
+#define _FIFO_IS_IN_ISR(desc)                   ((desc)->pxIface->pfIsInIsr())
+#endif
+
+#if defined(CL_FIFO_STATIC_CIRCULAR_BUFFER) && defined(CL_FIFO_IS_IN_ISR)
+#define _FIFO_IFACE_REQUIRED                    CL_FALSE
+#else
+#define _FIFO_IFACE_REQUIRED                    CL_TRUE
+#endif
+
 typedef struct FIFO_Internal_T {
 	const FifoIface_t *const pxIface;
 	const FifoIfaceEx_t *const pxIfaceEx;
 	uint16_t validation;
 	uint8_t rdBufIndex      : 1,
 	        isDouble        : 1,
-	        isInTransaction : 1;
+	        isInTransaction : 1,
+	        isReserved      : 1;
 	uint8_t reserved;
+	uint32_t rdAvailable; /* lower bound of read buffer data, saves availability queries on buffers switch checks */
 	void *buffer[2];
 } _Fifo_t;
 
 LIB_ASSERRT_STRUCTURE_CAST(_Fifo_t, Fifo_t, FIFIO_DESCRIPTOR_SIZE, "Fifo.h");
 
-static uint8_t _bSwitchBuffer(_Fifo_t *pxDesc) {
-	if (pxDesc->isDouble && !pxDesc->isInTransaction && !pxDesc->pxIface->pfIsInIsr()) {
-		if (pxDesc->pxIface->pfBufferAvailable(pxDesc->buffer[pxDesc->rdBufIndex]) == 0) {
-			pxDesc->rdBufIndex = !pxDesc->rdBufIndex;
-			return CL_TRUE;
+/*
+  Read buffer availability cache. Writers never add data to read buffer of double
+  bufferization, so availability seen once only decreases by reads until buffers switch.
+  Reads and shifts subtract taken data, switch and flush invalidate it.
+ */
+static inline void _vFifoRdCache(_Fifo_t *pxDesc, int32_t lAvailable) {
+	pxDesc->rdAvailable = (lAvailable > 0)? (uint32_t)lAvailable: 0;
+}
+
+static inline void _vFifoRdTaken(_Fifo_t *pxDesc, int32_t lTaken) {
+	if (lTaken > 0) {
+		pxDesc->rdAvailable = ((uint32_t)lTaken < pxDesc->rdAvailable)? (pxDesc->rdAvailable - lTaken): 0;
+	}
+}
+
+/* bRdEmpty: caller already knows that read buffer is empty */
+static uint8_t _bSwitchBuffer(_Fifo_t *pxDesc, uint8_t bRdEmpty) {
+	if (pxDesc->isDouble && !pxDesc->isInTransaction && !pxDesc->isReserved && !_FIFO_IS_IN_ISR(pxDesc)) {
+		if (!bRdEmpty) {
+			if (pxDesc->rdAvailable != 0) {
+				return CL_FALSE;
+			}
+			int32_t av = _FIFO_IFACE(pxDesc, pfBufferAvailable)(pxDesc->buffer[pxDesc->rdBufIndex]);
+			if (av != 0) {
+				_vFifoRdCache(pxDesc, av);
+				return CL_FALSE;
+			}
 		}
+		pxDesc->rdBufIndex = !pxDesc->rdBufIndex;
+		pxDesc->rdAvailable = 0;
+		return CL_TRUE;
 	}
 	return CL_FALSE;
 }
 
+#ifdef CL_FIFO_WAIT
+
+#ifndef __linux__
+#error "CL_FIFO_WAIT is supported on Linux only"
+#endif
+
+#if defined(__x86_64__)
+#define _FIFO_SYS_FUTEX                         202
+#define _FIFO_SYS_CLOCK_GETTIME                 228
+#elif defined(__i386__)
+#define _FIFO_SYS_FUTEX                         240
+#define _FIFO_SYS_CLOCK_GETTIME                 265
+#elif defined(__aarch64__) || (defined(__riscv) && (__riscv_xlen == 64))
+#define _FIFO_SYS_FUTEX                         98
+#define _FIFO_SYS_CLOCK_GETTIME                 113
+#elif defined(__arm__)
+#define _FIFO_SYS_FUTEX                         240
+#define _FIFO_SYS_CLOCK_GETTIME                 263
+#else
+#error "CL_FIFO_WAIT: unsupported architecture"
+#endif
+
+#define _FIFO_FUTEX_WAKE_PRIVATE                (1 | 128)
+#define _FIFO_FUTEX_WAIT_BITSET_PRIVATE         (9 | 128)
+#define _FIFO_FUTEX_BITSET_MATCH_ANY            0xFFFFFFFF
+#define _FIFO_CLOCK_MONOTONIC                   1
+
+/* Fifos are hashed to shared wait slots, collisions only cause spurious wakeups */
+#define _FIFO_WAIT_SLOTS_BITS                   4
+
+typedef struct {
+	uint32_t seq;
+	uint32_t waiters;
+} _FifoWaitSlot_t;
+
+typedef struct {
+	long tv_sec;
+	long tv_nsec;
+} _FifoTimespec_t;
+
+extern long syscall(long lNumber, ...);
+
+static _FifoWaitSlot_t _axFifoWaitSlots[1 << _FIFO_WAIT_SLOTS_BITS];
+
+static _FifoWaitSlot_t *_pxFifoWaitSlot(_Fifo_t *pxDesc) {
+	uint32_t hash = ((uint32_t)((size_t)pxDesc >> 2)) * 0x9E3779B1;
+	return &_axFifoWaitSlots[hash >> (32 - _FIFO_WAIT_SLOTS_BITS)];
+}
+
+/* Costs a fence and a load when nobody waits */
+static void _vFifoNotify(_Fifo_t *pxDesc) {
+	_FifoWaitSlot_t *slot = _pxFifoWaitSlot(pxDesc);
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&slot->waiters, __ATOMIC_RELAXED)) {
+		__atomic_fetch_add(&slot->seq, 1, __ATOMIC_SEQ_CST);
+		syscall(_FIFO_SYS_FUTEX, &slot->seq, _FIFO_FUTEX_WAKE_PRIVATE, 0x7FFFFFFF, libNULL, libNULL, 0);
+	}
+}
+
+static int32_t _lFifoAvailableTo(_Fifo_t *pxDesc, uint8_t bReadData);
+
+static int32_t _lFifoWait(_Fifo_t *pxDesc, BufferSize_t uMinCount, uint32_t ulTimeout, uint8_t bReadData) {
+	_FifoWaitSlot_t *slot = _pxFifoWaitSlot(pxDesc);
+	_FifoTimespec_t deadline, now;
+	if (ulTimeout != FIFO_WAIT_FOREVER) {
+		syscall(_FIFO_SYS_CLOCK_GETTIME, _FIFO_CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += ulTimeout / 1000;
+		deadline.tv_nsec += (ulTimeout % 1000) * 1000000;
+		if (deadline.tv_nsec >= 1000000000) {
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+	}
+	while (1) {
+		/* Register first, then check: notifier either sees waiter or waiter sees data */
+		__atomic_fetch_add(&slot->waiters, 1, __ATOMIC_SEQ_CST);
+		uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_SEQ_CST);
+		int32_t av = _lFifoAvailableTo(pxDesc, bReadData);
+		if ((av < 0) || ((BufferSize_t)av >= uMinCount) || (ulTimeout == 0)) {
+			__atomic_fetch_sub(&slot->waiters, 1, __ATOMIC_SEQ_CST);
+			return av;
+		}
+		if (ulTimeout != FIFO_WAIT_FOREVER) {
+			syscall(_FIFO_SYS_CLOCK_GETTIME, _FIFO_CLOCK_MONOTONIC, &now);
+			if ((now.tv_sec > deadline.tv_sec) || ((now.tv_sec == deadline.tv_sec) && (now.tv_nsec >= deadline.tv_nsec))) {
+				__atomic_fetch_sub(&slot->waiters, 1, __ATOMIC_SEQ_CST);
+				return av;
+			}
+		}
+		syscall(_FIFO_SYS_FUTEX, &slot->seq, _FIFO_FUTEX_WAIT_BITSET_PRIVATE, seq,
+				(ulTimeout != FIFO_WAIT_FOREVER)? &deadline: libNULL, libNULL, _FIFO_FUTEX_BITSET_MATCH_ANY);
+		__atomic_fetch_sub(&slot->waiters, 1, __ATOMIC_SEQ_CST);
+	}
+}
+
+#else
+#define _vFifoNotify(desc)
+#endif
+
 uint8_t bFifoIsValid(Fifo_t *pxFifo) {
 	return (pxFifo != libNULL) && (((_Fifo_t *)pxFifo)->validation == FIFO_VALIDATION_MARKER);
 }
@@ -33,39 +197,44 @@ static int32_t _lFifoAvailableTo(_Fifo_t *pxDesc, uint8_t bReadData) {
 	int32_t av = -1;
 	if (bFifoIsValid((Fifo_t *)pxDesc)) {
 		if (bReadData) {
-			_bSwitchBuffer(pxDesc);
-			av = pxDesc->pxIface->pfBufferAvailable(pxDesc->buffer[pxDesc->rdBufIndex]);
-			if ((pxDesc->isDouble) && (!pxDesc->pxIface->pfIsInIsr()))
-				av += pxDesc->pxIface->pfBufferAvailable(pxDesc->buffer[!pxDesc->rdBufIndex]);
+			av = _FIFO_IFACE(pxDesc, pfBufferAvailable)(pxDesc->buffer[pxDesc->rdBufIndex]);
+			if ((av == 0) && _bSwitchBuffer(pxDesc, CL_TRUE)) {
+				av = _FIFO_IFACE(pxDesc, pfBufferAvailable)(pxDesc->buffer[pxDesc->rdBufIndex]);
+			}
+			_vFifoRdCache(pxDesc, av);
+			if ((pxDesc->isDouble) && (!_FIFO_IS_IN_ISR(pxDesc)))
+				av += _FIFO_IFACE(pxDesc, pfBufferAvailable)(pxDesc->buffer[!pxDesc->rdBufIndex]);
 		}
 		else {
-			if (pxDesc->isDouble) av = pxDesc->pxIface->pfBufferFree(pxDesc->buffer[!pxDesc->rdBufIndex]);
-			else av = pxDesc->pxIface->pfBufferFree(pxDesc->buffer[0]);
+			if (pxDesc->isDouble) av = _FIFO_IFACE(pxDesc, pfBufferFree)(pxDesc->buffer[!pxDesc->rdBufIndex]);
+			else av = _FIFO_IFACE(pxDesc, pfBufferFree)(pxDesc->buffer[0]);
 		}
 	}
 	return av;
 }
 
-uint8_t bFifoInit(Fifo_t *pxFifo, uint8_t *pucBuffer, uint16_t uSize, uint8_t isDoubleBufferization) {
-	if ((pxFifo == libNULL) || (pucBuffer == libNULL) || (pxFifo->pxIface == libNULL)) 
+uint8_t bFifoInit(Fifo_t *pxFifo, uint8_t *pucBuffer, BufferSize_t uSize, uint8_t isDoubleBufferization) {
+	if ((pxFifo == libNULL) || (pucBuffer == libNULL) || (_FIFO_IFACE_REQUIRED && (pxFifo->pxIface == libNULL))) 
 	  return CL_FALSE;
 	_Fifo_t *pxDescriptor = (_Fifo_t *)pxFifo;
 	pxDescriptor->validation = FIFO_VALIDATION_MARKER;
 	pxDescriptor->isDouble = 0;
 	pxDescriptor->isInTransaction = 0;
+	pxDescriptor->isReserved = 0;
 	pxDescriptor->isDouble = (isDoubleBufferization != 0);
 	pxDescriptor->rdBufIndex = 0;
+	pxDescriptor->rdAvailable = 0;
 	if (isDoubleBufferization) {
 		uSize >>= 1;
-		pxDescriptor->buffer[1] = pxDescriptor->pxIface->pfBufferInit(pucBuffer + uSize, uSize);
+		pxDescriptor->buffer[1] = _FIFO_IFACE(pxDescriptor, pfBufferInit)(pucBuffer + uSize, uSize);
 		if (pxDescriptor->buffer[1] == libNULL) {
 			return CL_FALSE;
 		}
 	}
-	pxDescriptor->buffer[0] = pxDescriptor->pxIface->pfBufferInit(pucBuffer, uSize);
+	pxDescriptor->buffer[0] = _FIFO_IFACE(pxDescriptor, pfBufferInit)(pucBuffer, uSize);
 	if (pxDescriptor->buffer[0] == libNULL) {
 		if (isDoubleBufferization) 
-		    pxDescriptor->pxIface->pfBufferFree(pxDescriptor->buffer[1]);
+		    _FIFO_IFACE(pxDescriptor, pfBufferFree)(pxDescriptor->buffer[1]);
 		return CL_FALSE;
 	}
 	return CL_TRUE;
@@ -74,26 +243,32 @@ uint8_t bFifoInit(Fifo_t *pxFifo, uint8_t *pucBuffer, uint16_t uSize, uint8_t is
 void vFifoFlush(Fifo_t *pxDescriptor) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
 	if (bFifoIsValid(pxDescriptor)) {
-		pxDescriptor->pxIface->pfBufferFlush(desc->buffer[desc->rdBufIndex]);
+		_FIFO_IFACE(pxDescriptor, pfBufferFlush)(desc->buffer[desc->rdBufIndex]);
 		if (desc->isDouble) {
-			pxDescriptor->pxIface->pfBufferFlush(desc->buffer[!desc->rdBufIndex]);
+			_FIFO_IFACE(pxDescriptor, pfBufferFlush)(desc->buffer[!desc->rdBufIndex]);
 		}
+		desc->rdAvailable = 0;
+		_vFifoNotify(desc);
 	}
 }
 
-int32_t lFifoShift(Fifo_t *pxDescriptor, uint16_t uCount) {
+int32_t lFifoShift(Fifo_t *pxDescriptor, BufferSize_t uCount) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
 	if (bFifoIsValid(pxDescriptor)) {
 		uint8_t dummyBuf;
-		int32_t removed = pxDescriptor->pxIface->pfBufferRead(desc->buffer[desc->rdBufIndex], &dummyBuf, 0, uCount, 0);
-		if ((removed > 0) && _bSwitchBuffer(desc)) {
-			if (removed < uCount) {
-				uint32_t res = pxDescriptor->pxIface->pfBufferRead(desc->buffer[desc->rdBufIndex], &dummyBuf, 0, uCount - removed, 0);
+		int32_t removed = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[desc->rdBufIndex], &dummyBuf, 0, uCount, 0);
+		_vFifoRdTaken(desc, removed);
+		if ((removed >= 0) && _bSwitchBuffer(desc, (BufferSize_t)removed < uCount)) {
+			if ((BufferSize_t)removed < uCount) {
+				int32_t res = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[desc->rdBufIndex], &dummyBuf, 0, uCount - removed, 0);
 				if (res > 0) {
 					removed += res;
 				}
 			}
 		}
+		if (removed > 0) {
+			_vFifoNotify(desc);
+		}
 		return removed;
 	}
 	return -1;
@@ -103,12 +278,12 @@ int32_t lFifoAvailableToRead(Fifo_t *pxDescriptor) {
 	return _lFifoAvailableTo((_Fifo_t *)pxDescriptor, 1);
 }
 
-int32_t lFifoPeek(Fifo_t *pxDescriptor, uint8_t *pucOutBuf, uint16_t uCount) {
+int32_t lFifoPeek(Fifo_t *pxDescriptor, uint8_t *pucOutBuf, BufferSize_t uCount) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
 	if (bFifoIsValid(pxDescriptor)) {
-		int32_t readed = pxDescriptor->pxIface->pfBufferRead(desc->buffer[desc->rdBufIndex], pucOutBuf, uCount, 0, 1);
-		if (desc->isDouble && (readed >= 0) && !desc->pxIface->pfIsInIsr() && (readed < uCount)) {
-			int32_t res = pxDescriptor->pxIface->pfBufferRead(desc->buffer[!desc->rdBufIndex], pucOutBuf + readed, uCount - readed, 0, 1);
+		int32_t readed = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[desc->rdBufIndex], pucOutBuf, uCount, 0, 1);
+		if (desc->isDouble && (readed >= 0) && !_FIFO_IS_IN_ISR(desc) && ((BufferSize_t)readed < uCount)) {
+			int32_t res = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[!desc->rdBufIndex], pucOutBuf + readed, uCount - readed, 0, 1);
 			if (res > 0) {
 				readed += res;
 			}
@@ -118,16 +293,55 @@ int32_t lFifoPeek(Fifo_t *pxDescriptor, uint8_t *pucOutBuf, uint16_t uCount) {
 	return -1;
 }
 
-int32_t lFifoRead(Fifo_t *pxDescriptor, uint8_t *pucOutBuf, uint16_t uCount) {
+int32_t lFifoPeekSpans(Fifo_t *pxDescriptor, FifoSpan_t axSpans[2]) {
+	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferReadSpan) && (axSpans != libNULL)) {
+		axSpans[1].pucData = libNULL;
+		axSpans[1].uLen = 0;
+		int32_t len = _FIFO_IFACE_EX(desc, pfBufferReadSpan)(desc->buffer[desc->rdBufIndex], 0, &axSpans[0].pucData);
+		if (len < 0) {
+			return -1;
+		}
+		if ((len == 0) && _bSwitchBuffer(desc, CL_TRUE)) {
+			len = _FIFO_IFACE_EX(desc, pfBufferReadSpan)(desc->buffer[desc->rdBufIndex], 0, &axSpans[0].pucData);
+		}
+		axSpans[0].uLen = len;
+		if (len > 0) {
+			/* Wrapped data of the read buffer */
+			int32_t res = _FIFO_IFACE_EX(desc, pfBufferReadSpan)(desc->buffer[desc->rdBufIndex], len, &axSpans[1].pucData);
+			if (res > 0) {
+				axSpans[1].uLen = res;
+			}
+		}
+		/* Write buffer data can be released by shift only when buffers switch is allowed */
+		if ((axSpans[1].uLen == 0) && desc->isDouble && !desc->isInTransaction && !desc->isReserved && !_FIFO_IS_IN_ISR(desc)) {
+			int32_t res = _FIFO_IFACE_EX(desc, pfBufferReadSpan)(desc->buffer[!desc->rdBufIndex], 0, &axSpans[1].pucData);
+			if (res > 0) {
+				axSpans[1].uLen = res;
+			}
+		}
+		if (axSpans[1].uLen == 0) {
+			axSpans[1].pucData = libNULL;
+		}
+		return axSpans[0].uLen + axSpans[1].uLen;
+	}
+	return -1;
+}
+
+int32_t lFifoRead(Fifo_t *pxDescriptor, uint8_t *pucOutBuf, BufferSize_t uCount) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
 	if (bFifoIsValid(pxDescriptor)) {
-		int32_t readed = pxDescriptor->pxIface->pfBufferRead(desc->buffer[desc->rdBufIndex], pucOutBuf, uCount, 0, 0);
-		if ((readed >= 0) && (readed < uCount) && _bSwitchBuffer(desc)) {
-			int32_t res = pxDescriptor->pxIface->pfBufferRead(desc->buffer[desc->rdBufIndex], pucOutBuf + readed, uCount - readed, 0, 0);
+		int32_t readed = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[desc->rdBufIndex], pucOutBuf, uCount, 0, 0);
+		_vFifoRdTaken(desc, readed);
+		if ((readed >= 0) && ((BufferSize_t)readed < uCount) && _bSwitchBuffer(desc, CL_TRUE)) {
+			int32_t res = _FIFO_IFACE(pxDescriptor, pfBufferRead)(desc->buffer[desc->rdBufIndex], pucOutBuf + readed, uCount - readed, 0, 0);
 			if (res > 0) {
 				readed += res;
 			}
 		}
+		if (readed > 0) {
+			_vFifoNotify(desc);
+		}
 		return readed;
 	}
 	return -1;
@@ -141,32 +355,46 @@ int32_t lFifoAvailableToWrite(Fifo_t *pxDescriptor) {
 	return _lFifoAvailableTo((_Fifo_t *)pxDescriptor, 0);
 }
 
-static inline int32_t _lFifoWrite(Fifo_t *pxDescriptor, const uint8_t *pucData, uint16_t uCount, uint8_t bRepeatMode, uint8_t bAllOrNothing, uint8_t bAsString) {
+#ifdef CL_FIFO_WAIT
+int32_t lFifoWaitReadable(Fifo_t *pxDescriptor, BufferSize_t uMinCount, uint32_t ulTimeout) {
+	return _lFifoWait((_Fifo_t *)pxDescriptor, uMinCount, ulTimeout, 1);
+}
+
+int32_t lFifoWaitWritable(Fifo_t *pxDescriptor, BufferSize_t uMinCount, uint32_t ulTimeout) {
+	return _lFifoWait((_Fifo_t *)pxDescriptor, uMinCount, ulTimeout, 0);
+}
+#endif
+
+static inline int32_t _lFifoWrite(Fifo_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bRepeatMode, uint8_t bAllOrNothing, uint8_t bAsString) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
-	if (bFifoIsValid(pxDescriptor)) {
+	/* Reserved space is ahead of head, data writed now would be overwritten by commit */
+	if (bFifoIsValid(pxDescriptor) && !desc->isReserved) {
 		int32_t wrBufIndex = 0;
 		if (desc->isDouble) {
 			wrBufIndex = !(desc->rdBufIndex);
 		}
-		int32_t writed = pxDescriptor->pxIface->pfBufferWrite(desc->buffer[wrBufIndex], pucData, uCount, bRepeatMode, bAllOrNothing, bAsString);
-		if (writed >= 0 && _bSwitchBuffer(desc)) {
-			if ((writed == 0) || (((!bAsString)&&(writed < uCount)) || ((bAsString)&&(pucData[writed - 1] != '\0')))) {
-				int32_t res = pxDescriptor->pxIface->pfBufferWrite(desc->buffer[!desc->rdBufIndex], pucData + writed, uCount - writed, bRepeatMode, bAllOrNothing, bAsString);
+		int32_t writed = _FIFO_IFACE(pxDescriptor, pfBufferWrite)(desc->buffer[wrBufIndex], pucData, uCount, bRepeatMode, bAllOrNothing, bAsString);
+		if (writed >= 0 && _bSwitchBuffer(desc, CL_FALSE)) {
+			if ((writed == 0) || (((!bAsString)&&((BufferSize_t)writed < uCount)) || ((bAsString)&&(pucData[writed - 1] != '\0')))) {
+				int32_t res = _FIFO_IFACE(pxDescriptor, pfBufferWrite)(desc->buffer[!desc->rdBufIndex], pucData + writed, uCount - writed, bRepeatMode, bAllOrNothing, bAsString);
 				if (res > 0) {
 					writed += res;
 				}
 			}
 		}
+		if (writed > 0) {
+			_vFifoNotify(desc);
+		}
 		return writed;
 	}
 	return -1;
 }
 
-int32_t lFifoWrite(Fifo_t *pxDescriptor, const uint8_t *pucData, uint16_t uCount) {
+int32_t lFifoWrite(Fifo_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount) {
 	return _lFifoWrite(pxDescriptor, pucData, uCount, 0, 0, 0);
 }
 
-int32_t lFifoWriteAll(Fifo_t *pxDescriptor, const uint8_t *pucData, uint16_t uCount) {
+int32_t lFifoWriteAll(Fifo_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount) {
 	return _lFifoWrite(pxDescriptor, pucData, uCount, 0, 1, 0);
 }
 
@@ -174,11 +402,11 @@ uint8_t bFifoWriteByte(Fifo_t *pxDescriptor, uint8_t ucData) {
 	return _lFifoWrite(pxDescriptor, &ucData, 1, 0, 0, 0) > 0;
 }
 
-int32_t lFifoFill(Fifo_t *pxDescriptor, uint8_t cFiller, uint16_t uCount) {
+int32_t lFifoFill(Fifo_t *pxDescriptor, uint8_t cFiller, BufferSize_t uCount) {
 	return _lFifoWrite(pxDescriptor, &cFiller, uCount, 1, 0, 0);
 }
 
-int32_t lFifoFillAll(Fifo_t *pxDescriptor, uint8_t cFiller, uint16_t uCount) {
+int32_t lFifoFillAll(Fifo_t *pxDescriptor, uint8_t cFiller, BufferSize_t uCount) {
 	return _lFifoWrite(pxDescriptor, &cFiller, uCount, 1, 1, 0);
 }
 
@@ -190,15 +418,91 @@ int32_t lFifoWriteStringAll(Fifo_t *pxDescriptor, const char *pcString) {
 	return _lFifoWrite(pxDescriptor, (uint8_t *)pcString, -1, 0, 1, 1);
 }
 
+uint8_t bFifoWriteReserve(Fifo_t *pxDescriptor, BufferSize_t uMinLen, uint8_t **ppucOutBuffer, BufferSize_t *puOutLen) {
+	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferWriteReserve) &&
+		_FIFO_HAS_IFACE_EX(desc, pfBufferWriteCommit) && (ppucOutBuffer != libNULL) && !desc->isReserved) {
+		uint8_t wrBufInd = 0;
+		if (desc->isDouble) {
+			wrBufInd = !desc->rdBufIndex;
+		}
+		int32_t len = _FIFO_IFACE_EX(desc, pfBufferWriteReserve)(desc->buffer[wrBufInd], ppucOutBuffer);
+		if ((len >= 0) && ((len == 0) || ((BufferSize_t)len < uMinLen)) && _bSwitchBuffer(desc, CL_FALSE)) {
+			len = _FIFO_IFACE_EX(desc, pfBufferWriteReserve)(desc->buffer[!desc->rdBufIndex], ppucOutBuffer);
+		}
+		if ((len > 0) && ((BufferSize_t)len >= uMinLen)) {
+			desc->isReserved = 1;
+			if (puOutLen != libNULL) {
+				*puOutLen = len;
+			}
+			return CL_TRUE;
+		}
+	}
+	return CL_FALSE;
+}
+
+uint8_t bFifoWriteCommit(Fifo_t *pxDescriptor, BufferSize_t uCount) {
+	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferWriteCommit) && desc->isReserved) {
+		uint8_t wrBufInd = 0;
+		if (desc->isDouble) {
+			wrBufInd = !desc->rdBufIndex;
+		}
+		int32_t commited = _FIFO_IFACE_EX(desc, pfBufferWriteCommit)(desc->buffer[wrBufInd], uCount);
+		desc->isReserved = 0;
+		_bSwitchBuffer(desc, CL_FALSE);
+		if (commited > 0) {
+			_vFifoNotify(desc);
+		}
+		return (commited >= 0) && ((BufferSize_t)commited == uCount);
+	}
+	return CL_FALSE;
+}
+
+int32_t lFifoWriteClaim(Fifo_t *pxDescriptor, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket) {
+#ifndef CL_FIFO_STATIC_CIRCULAR_BUFFER
+	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
+	/* Double buffer switch is not safe for concurrent producers */
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferClaim) && _FIFO_HAS_IFACE_EX(desc, pfBufferPublish) &&
+		!desc->isDouble && !desc->isReserved && (apucSpans != libNULL) && (pulTicket != libNULL)) {
+		return _FIFO_IFACE_EX(desc, pfBufferClaim)(desc->buffer[0], uCount, apucSpans, pulTicket);
+	}
+#else
+	libUNUSED(pxDescriptor);
+	libUNUSED(uCount);
+	libUNUSED(apucSpans);
+	libUNUSED(pulTicket);
+#endif
+	return -1;
+}
+
+uint8_t bFifoWritePublish(Fifo_t *pxDescriptor, uint32_t ulTicket, BufferSize_t uCount) {
+#ifndef CL_FIFO_STATIC_CIRCULAR_BUFFER
+	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferPublish) && !desc->isDouble) {
+		_FIFO_IFACE_EX(desc, pfBufferPublish)(desc->buffer[0], ulTicket, uCount);
+		if (uCount != 0) {
+			_vFifoNotify(desc);
+		}
+		return CL_TRUE;
+	}
+#else
+	libUNUSED(pxDescriptor);
+	libUNUSED(ulTicket);
+	libUNUSED(uCount);
+#endif
+	return CL_FALSE;
+}
+
 uint8_t bFifoTransactionBegin(Fifo_t *pxDescriptor) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
-	if (bFifoIsValid(pxDescriptor) && (desc->pxIfaceEx != libNULL)) {
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferBackup)) {
 		if (!desc->isInTransaction) {
 			uint8_t wrBufInd = 0;
 			if (desc->isDouble) {
 				wrBufInd = !desc->rdBufIndex;
 			}
-			desc->isInTransaction = desc->pxIfaceEx->pfBufferBackup(desc->buffer[wrBufInd]);
+			desc->isInTransaction = _FIFO_IFACE_EX(desc, pfBufferBackup)(desc->buffer[wrBufInd]);
 		}
 		return desc->isInTransaction;
 	}
@@ -207,15 +511,16 @@ uint8_t bFifoTransactionBegin(Fifo_t *pxDescriptor) {
 
 uint8_t bFifoTransactionCommit(Fifo_t *pxDescriptor) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
-	if (bFifoIsValid(pxDescriptor) && (desc->pxIfaceEx != libNULL)) {
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferCommit)) {
 		if (desc->isInTransaction) {
 			uint8_t wrBufInd = 0;
 			if (desc->isDouble) {
 				wrBufInd = !desc->rdBufIndex;
 			}
-			desc->isInTransaction = !desc->pxIfaceEx->pfBufferCommit(desc->buffer[wrBufInd]);
+			desc->isInTransaction = !_FIFO_IFACE_EX(desc, pfBufferCommit)(desc->buffer[wrBufInd]);
 			if (!desc->isInTransaction) {
-				_bSwitchBuffer(desc);
+				_bSwitchBuffer(desc, CL_FALSE);
+				_vFifoNotify(desc);
 			}
 		}
 		return !desc->isInTransaction;
@@ -225,13 +530,13 @@ uint8_t bFifoTransactionCommit(Fifo_t *pxDescriptor) {
 
 uint8_t bFifoTransactionRollback(Fifo_t *pxDescriptor) {
 	_Fifo_t *desc = (_Fifo_t *)pxDescriptor;
-	if (bFifoIsValid(pxDescriptor) && (desc->pxIfaceEx != libNULL)) {
+	if (bFifoIsValid(pxDescriptor) && _FIFO_HAS_IFACE_EX(desc, pfBufferRestore)) {
 		if (desc->isInTransaction) {
 			uint8_t wrBufInd = 0;
 			if (desc->isDouble) {
 				wrBufInd = !desc->rdBufIndex;
 			}
-			desc->isInTransaction = !desc->pxIfaceEx->pfBufferRestore(desc->buffer[wrBufInd]);
+			desc->isInTransaction = !_FIFO_IFACE_EX(desc, pfBufferRestore)(desc->buffer[wrBufInd]);
 		}
 		return !desc->isInTransaction;
 	}
@@ -242,22 +547,31 @@ uint8_t bFifoTransactionRollback(Fifo_t *pxDescriptor) {
   Snake notation
 */
 
-uint8_t fifo_init(Fifo_t *, uint8_t *, uint16_t , uint8_t) __attribute__ ((alias ("bFifoInit")));
+uint8_t fifo_init(Fifo_t *, uint8_t *, BufferSize_t , uint8_t) __attribute__ ((alias ("bFifoInit")));
 uint8_t fifo_is_valid(fifo_t *) __attribute__ ((alias ("bFifoIsValid")));
 int32_t fifo_available_to_read(fifo_t *) __attribute__ ((alias ("lFifoAvailableToRead")));
 int32_t fifo_available_to_write(fifo_t *) __attribute__ ((alias ("lFifoAvailableToWrite")));
-int32_t fifo_write(fifo_t *, const uint8_t *, uint16_t) __attribute__ ((alias ("lFifoWrite")));
-int32_t fifo_write_all(fifo_t *, const uint8_t *, uint16_t) __attribute__ ((alias ("lFifoWriteAll")));
-int32_t fifo_fill(fifo_t *, uint8_t, uint16_t) __attribute__ ((alias ("lFifoFill")));
-int32_t fifo_fill_all(fifo_t *, uint8_t, uint16_t) __attribute__ ((alias ("lFifoFillAll")));
+int32_t fifo_write(fifo_t *, const uint8_t *, BufferSize_t) __attribute__ ((alias ("lFifoWrite")));
+int32_t fifo_write_all(fifo_t *, const uint8_t *, BufferSize_t) __attribute__ ((alias ("lFifoWriteAll")));
+int32_t fifo_fill(fifo_t *, uint8_t, BufferSize_t) __attribute__ ((alias ("lFifoFill")));
+int32_t fifo_fill_all(fifo_t *, uint8_t, BufferSize_t) __attribute__ ((alias ("lFifoFillAll")));
 int32_t fifo_write_string(fifo_t *, const char *) __attribute__ ((alias ("lFifoWriteString")));
 int32_t fifo_write_string_all(fifo_t *, const char *) __attribute__ ((alias ("lFifoWriteStringAll")));
 uint8_t fifo_write_byte(fifo_t *, uint8_t) __attribute__ ((alias ("bFifoWriteByte")));
-int32_t fifo_read(fifo_t *, uint8_t *, uint16_t) __attribute__ ((alias ("lFifoRead")));
-int32_t fifo_peek(fifo_t *, uint8_t *, uint16_t) __attribute__ ((alias ("lFifoPeek")));
-int32_t fifo_shift(fifo_t *, uint16_t) __attribute__ ((alias ("lFifoShift")));
+int32_t fifo_read(fifo_t *, uint8_t *, BufferSize_t) __attribute__ ((alias ("lFifoRead")));
+int32_t fifo_peek(fifo_t *, uint8_t *, BufferSize_t) __attribute__ ((alias ("lFifoPeek")));
+#ifdef CL_FIFO_WAIT
+int32_t fifo_wait_readable(fifo_t *, buffer_size_t, uint32_t) __attribute__ ((alias ("lFifoWaitReadable")));
+int32_t fifo_wait_writable(fifo_t *, buffer_size_t, uint32_t) __attribute__ ((alias ("lFifoWaitWritable")));
+#endif
+int32_t fifo_peek_spans(fifo_t *, fifo_span_t [2]) __attribute__ ((alias ("lFifoPeekSpans")));
+int32_t fifo_shift(fifo_t *, BufferSize_t) __attribute__ ((alias ("lFifoShift")));
 void fifo_flush(fifo_t *) __attribute__ ((alias ("vFifoFlush")));
 uint8_t fifo_read_byte(fifo_t *, uint8_t*) __attribute__ ((alias ("bFifoReadByte")));
+uint8_t fifo_write_reserve(fifo_t *, BufferSize_t, uint8_t **, BufferSize_t *) __attribute__ ((alias ("bFifoWriteReserve")));
+uint8_t fifo_write_commit(fifo_t *, BufferSize_t) __attribute__ ((alias ("bFifoWriteCommit")));
+int32_t fifo_write_claim(fifo_t *, buffer_size_t, uint8_t *[2], uint32_t *) __attribute__ ((alias ("lFifoWriteClaim")));
+uint8_t fifo_write_publish(fifo_t *, uint32_t, buffer_size_t) __attribute__ ((alias ("bFifoWritePublish")));
 
 uint8_t fifo_transaction_begin(fifo_t *) __attribute__ ((alias ("bFifoTransactionBegin")));
 uint8_t fifo_transaction_commit(fifo_t *) __attribute__ ((alias ("bFifoTransactionCommit")));
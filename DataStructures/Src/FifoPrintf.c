@@ -1,19 +1,108 @@
 #include "CodeLib.h"
 
-static inline int32_t _lFifoPrintfWriter(void *pxDesc, uint8_t *ucBuf, uint32_t ulLen) {
+/* Formatter run, same arguments give the same output on every pass */
+typedef int32_t (*_FifoPrintfPass_t)(PrintfWriter_t pfWriter, void *pxWrContext, const void *pvArgs);
+
+/* Claimed record space, filled by second formatting pass */
+typedef struct {
+	uint8_t *apucSpans[2];
+	uint32_t ulFirst;
+	uint32_t ulLen;
+	uint32_t ulPos;
+} _FifoPrintfRecord_t;
+
+typedef struct {
+	const char *pcFormat;
+	va_list xArgs;
+} _FifoPrintfVArgs_t;
+
+typedef struct {
+	uint64_t ullValue;
+	FifoPrintIntegerFlags_t eFlags;
+} _FifoPrintfIntArgs_t;
+
+static int32_t _lFifoPrintfWriter(void *pxDesc, uint8_t *ucBuf, uint32_t ulLen) {
 	return lFifoWrite((Fifo_t *)pxDesc, ucBuf, ulLen);
 }
 
-inline int32_t lFifoVPrintf(Fifo_t *pxFifo, const char* pcFormat, va_list xArgs) {
-	return lClVPrintf(&_lFifoPrintfWriter, pxFifo, pcFormat, xArgs);
+static int32_t _lFifoPrintfCounter(void *pxDesc, uint8_t *ucBuf, uint32_t ulLen) {
+	libUNUSED(ucBuf);
+	*((uint32_t *)pxDesc) += ulLen;
+	return ulLen;
+}
+
+static int32_t _lFifoPrintfRecordWriter(void *pxDesc, uint8_t *ucBuf, uint32_t ulLen) {
+	_FifoPrintfRecord_t *rec = (_FifoPrintfRecord_t *)pxDesc;
+	ulLen = CL_MIN(ulLen, rec->ulLen - rec->ulPos);
+	uint32_t len = 0;
+	if (rec->ulPos < rec->ulFirst) {
+		len = CL_MIN(ulLen, rec->ulFirst - rec->ulPos);
+		mem_cpy(rec->apucSpans[0] + rec->ulPos, ucBuf, len);
+	}
+	if (len < ulLen) {
+		mem_cpy(rec->apucSpans[1] + (rec->ulPos + len - rec->ulFirst), ucBuf + len, ulLen - len);
+	}
+	rec->ulPos += ulLen;
+	return ulLen;
+}
+
+static int32_t _lFifoPrint(Fifo_t *pxFifo, _FifoPrintfPass_t pfPass, const void *pvArgs) {
+	_FifoPrintfRecord_t rec = {.ulPos = 0};
+	uint32_t ticket;
+	if (lFifoWriteClaim(pxFifo, 0, rec.apucSpans, &ticket) < 0) {
+		return pfPass(&_lFifoPrintfWriter, pxFifo, pvArgs);
+	}
+	/* Buffer with concurrent producers: measure record and write it with single claim */
+	uint32_t len = 0;
+	pfPass(&_lFifoPrintfCounter, &len, pvArgs);
+	if ((BufferSize_t)len != len) {
+		return 0;
+	}
+	int32_t first = lFifoWriteClaim(pxFifo, len, rec.apucSpans, &ticket);
+	if (first < 0) {
+		return 0;
+	}
+	rec.ulFirst = first;
+	rec.ulLen = len;
+	pfPass(&_lFifoPrintfRecordWriter, &rec, pvArgs);
+	bFifoWritePublish(pxFifo, ticket, len);
+	return len;
+}
+
+static int32_t _lFifoPrintfVPass(PrintfWriter_t pfWriter, void *pxWrContext, const void *pvArgs) {
+	_FifoPrintfVArgs_t *args = (_FifoPrintfVArgs_t *)pvArgs;
+	va_list passArgs;
+	va_copy(passArgs, args->xArgs);
+	int32_t res = lClVPrintf(pfWriter, pxWrContext, args->pcFormat, passArgs);
+	va_end(passArgs);
+	return res;
+}
+
+static int32_t _lFifoPrintfIntPass(PrintfWriter_t pfWriter, void *pxWrContext, const void *pvArgs) {
+	const _FifoPrintfIntArgs_t *args = (const _FifoPrintfIntArgs_t *)pvArgs;
+	return lClPrintInteger(pfWriter, pxWrContext, args->ullValue, args->eFlags);
+}
+
+static int32_t _lFifoPrintfFloatPass(PrintfWriter_t pfWriter, void *pxWrContext, const void *pvArgs) {
+	return lClPrintFloat(pfWriter, pxWrContext, *((const float *)pvArgs));
+}
+
+int32_t lFifoVPrintf(Fifo_t *pxFifo, const char* pcFormat, va_list xArgs) {
+	/* Each pass formats from its own copy of arguments */
+	_FifoPrintfVArgs_t args = {.pcFormat = pcFormat};
+	va_copy(args.xArgs, xArgs);
+	int32_t res = _lFifoPrint(pxFifo, &_lFifoPrintfVPass, &args);
+	va_end(args.xArgs);
+	return res;
 }
 
-inline int32_t lFifoPrintInteger(Fifo_t *pxFifo, uint64_t ullValue, FifoPrintIntegerFlags_t eFlags) {
-	return lClPrintInteger(&_lFifoPrintfWriter, pxFifo, ullValue, eFlags);
+int32_t lFifoPrintInteger(Fifo_t *pxFifo, uint64_t ullValue, FifoPrintIntegerFlags_t eFlags) {
+	_FifoPrintfIntArgs_t args = {.ullValue = ullValue, .eFlags = eFlags};
+	return _lFifoPrint(pxFifo, &_lFifoPrintfIntPass, &args);
 }
 
-inline int32_t lFifoPrintFloat(Fifo_t *pxFifo, float fpValue) {
-	return lClPrintFloat(&_lFifoPrintfWriter, pxFifo, fpValue);
+int32_t lFifoPrintFloat(Fifo_t *pxFifo, float fpValue) {
+	return _lFifoPrint(pxFifo, &_lFifoPrintfFloatPass, &fpValue);
 }
 
 int32_t fifo_print_float(Fifo_t *, float)  __attribute__ ((alias ("lFifoPrintFloat")));
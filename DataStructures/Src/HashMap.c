@@ -0,0 +1,181 @@
+#include "CodeLib.h"
+
+#define HASH_MAP_VALIDATION_NUMBER 0x4A5B3A90
+
+/* usDist is probe distance from home slot plus 1, 0 for empty slot */
+typedef struct {
+	const void *pvKey;
+	void *pvValue;
+	uint32_t ulHash;
+	uint16_t usKeySize;
+	uint16_t usDist;
+} _HashMapSlot_t;
+
+typedef struct {
+	_HashMapSlot_t *pxSlots;
+	HashMapHash_t pfHash;
+	uint32_t ulMask;
+	uint32_t ulCount;
+	uint8_t ucShift;
+	uint32_t validation;
+} _HashMap_t;
+
+LIB_ASSERRT_STRUCTURE_CAST(_HashMap_t, HashMap_t, HASH_MAP_DESCRIPTOR_SIZE, "HashMap.h");
+LIB_ASSERRT_STRUCTURE_CAST(_HashMapSlot_t, HashMapSlot_t, HASH_MAP_SLOT_SIZE, "HashMap.h");
+_Static_assert(sizeof(_HashMapSlot_t) == sizeof(HashMapSlot_t), "Slots storage is indexed as private slots");
+
+static _HashMap_t *_pxHashMapCast(HashMap_t *pxMap) {
+	_HashMap_t *map = (_HashMap_t *)pxMap;
+	return ((map == libNULL) || (map->validation != HASH_MAP_VALIDATION_NUMBER))? libNULL: map;
+}
+
+/* Fibonacci hashing spreads weak hashes over power of 2 table */
+static inline uint32_t _ulHashMapHome(_HashMap_t *pxMap, uint32_t ulHash) {
+	return (ulHash * 2654435769U) >> pxMap->ucShift;
+}
+
+static inline uint8_t _bHashMapMatch(_HashMapSlot_t *pxSlot, uint32_t ulHash, const void *pvKey, uint16_t usKeySize) {
+	return (pxSlot->ulHash == ulHash) && (pxSlot->usKeySize == usKeySize) && (mem_cmp(pxSlot->pvKey, pvKey, usKeySize) == 0);
+}
+
+/* Robin Hood invariant: key is not in the map once probe distance exceeds distance of the slot */
+static int32_t _lHashMapFindIndex(_HashMap_t *pxMap, uint32_t ulHash, const void *pvKey, uint16_t usKeySize) {
+	uint32_t index = _ulHashMapHome(pxMap, ulHash);
+	for (uint32_t dist = 1; ; dist++) {
+		_HashMapSlot_t *slot = &pxMap->pxSlots[index];
+		if (slot->usDist < dist) {
+			return -1;
+		}
+		if (_bHashMapMatch(slot, ulHash, pvKey, usKeySize)) {
+			return index;
+		}
+		index = (index + 1) & pxMap->ulMask;
+	}
+}
+
+uint8_t bHashMapInit(HashMap_t *pxMap, HashMapSlot_t *pxSlots, uint32_t ulCapacity, HashMapHash_t pfHash) {
+	_HashMap_t *map = (_HashMap_t *)pxMap;
+	/* Probe distance never exceeds items count, with 7/8 load limit it fits usDist */
+	if ((map == libNULL) || (pxSlots == libNULL) || (ulCapacity < 2) || (ulCapacity > 0x10000) || !CL_IS_A_POWER_OF_2(ulCapacity)) {
+		return CL_FALSE;
+	}
+	map->pxSlots = (_HashMapSlot_t *)pxSlots;
+	map->pfHash = (pfHash != libNULL)? pfHash: HashDjb2;
+	map->ulMask = ulCapacity - 1;
+	map->ucShift = 32;
+	while (ulCapacity >>= 1) {
+		map->ucShift--;
+	}
+	map->validation = HASH_MAP_VALIDATION_NUMBER;
+	vHashMapClear(pxMap);
+	return CL_TRUE;
+}
+
+uint8_t bHashMapInsert(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize, void *pvValue) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	if ((map == libNULL) || (pvKey == libNULL)) {
+		return CL_FALSE;
+	}
+	uint32_t hash = map->pfHash((void *)pvKey, usKeySize);
+	int32_t found = _lHashMapFindIndex(map, hash, pvKey, usKeySize);
+	if (found >= 0) {
+		map->pxSlots[found].pvValue = pvValue;
+		return CL_TRUE;
+	}
+	/* Keep load factor at most 7/8, probe sequences stay short */
+	if (map->ulCount >= (map->ulMask + 1) - ((map->ulMask + 1) >> 3)) {
+		return CL_FALSE;
+	}
+	_HashMapSlot_t item = { .pvKey = pvKey, .pvValue = pvValue, .ulHash = hash, .usKeySize = usKeySize, .usDist = 1 };
+	uint32_t index = _ulHashMapHome(map, hash);
+	while (1) {
+		_HashMapSlot_t *slot = &map->pxSlots[index];
+		if (slot->usDist == 0) {
+			*slot = item;
+			break;
+		}
+		/* Take the slot from the item closer to its home, carry that item further */
+		if (slot->usDist < item.usDist) {
+			_HashMapSlot_t tmp = *slot;
+			*slot = item;
+			item = tmp;
+		}
+		index = (index + 1) & map->ulMask;
+		item.usDist++;
+	}
+	map->ulCount++;
+	return CL_TRUE;
+}
+
+void *pvHashMapFind(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	if ((map == libNULL) || (pvKey == libNULL)) {
+		return libNULL;
+	}
+	int32_t index = _lHashMapFindIndex(map, map->pfHash((void *)pvKey, usKeySize), pvKey, usKeySize);
+	return (index < 0)? libNULL: map->pxSlots[index].pvValue;
+}
+
+void *pvHashMapRemove(HashMap_t *pxMap, const void *pvKey, uint16_t usKeySize) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	if ((map == libNULL) || (pvKey == libNULL)) {
+		return libNULL;
+	}
+	int32_t found = _lHashMapFindIndex(map, map->pfHash((void *)pvKey, usKeySize), pvKey, usKeySize);
+	if (found < 0) {
+		return libNULL;
+	}
+	uint32_t index = found;
+	void *value = map->pxSlots[index].pvValue;
+	/* Backward shift deletion, no tombstones */
+	while (1) {
+		uint32_t next = (index + 1) & map->ulMask;
+		_HashMapSlot_t *slot = &map->pxSlots[next];
+		if (slot->usDist <= 1) {
+			break;
+		}
+		map->pxSlots[index] = *slot;
+		map->pxSlots[index].usDist--;
+		index = next;
+	}
+	map->pxSlots[index].usDist = 0;
+	map->ulCount--;
+	return value;
+}
+
+uint32_t ulHashMapCount(HashMap_t *pxMap) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	return (map == libNULL)? 0: map->ulCount;
+}
+
+uint32_t ulHashMapDoForeach(HashMap_t *pxMap, HashMapAction_t pfAction, void *pvArg) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	if ((map == libNULL) || (pfAction == libNULL)) {
+		return 0;
+	}
+	for (uint32_t i = 0; i <= map->ulMask; i++) {
+		_HashMapSlot_t *slot = &map->pxSlots[i];
+		if (slot->usDist != 0) {
+			pfAction(slot->pvKey, slot->usKeySize, slot->pvValue, pvArg);
+		}
+	}
+	return map->ulCount;
+}
+
+void vHashMapClear(HashMap_t *pxMap) {
+	_HashMap_t *map = _pxHashMapCast(pxMap);
+	if (map != libNULL) {
+		for (uint32_t i = 0; i <= map->ulMask; i++) {
+			map->pxSlots[i].usDist = 0;
+		}
+		map->ulCount = 0;
+	}
+}
+
+uint8_t hash_map_init(hash_map_t *map, hash_map_slot_t *slots, uint32_t capacity, hash_map_hash_t hash_fn) __attribute__ ((alias ("bHashMapInit")));
+uint8_t hash_map_insert(hash_map_t *map, const void *key, uint16_t key_size, void *value) __attribute__ ((alias ("bHashMapInsert")));
+void *hash_map_find(hash_map_t *map, const void *key, uint16_t key_size) __attribute__ ((alias ("pvHashMapFind")));
+void *hash_map_remove(hash_map_t *map, const void *key, uint16_t key_size) __attribute__ ((alias ("pvHashMapRemove")));
+uint32_t hash_map_count(hash_map_t *map) __attribute__ ((alias ("ulHashMapCount")));
+uint32_t hash_map_do_foreach(hash_map_t *map, hash_map_action_t action_fn, void *arg) __attribute__ ((alias ("ulHashMapDoForeach")));
+void hash_map_clear(hash_map_t *map) __attribute__ ((alias ("vHashMapClear")));
@@ -10,7 +10,7 @@ typedef struct __LL_ITEM_T {
 
 LIB_ASSERRT_STRUCTURE_CAST(__LinkedListItem_t, LinkedListItem_t, LL_ITEM_SIZE, LinkedList.h);
 
-#define _bIsValidItem(it)         (((it) != libNULL) && ((it)->ovn == (((uint32_t)(it)) & 0x7fffffffUL)))
+#define _bIsValidItem(it)         (((it) != libNULL) && ((it)->ovn == (((uint32_t)(size_t)(it)) & 0x7fffffffUL)))
 
 void vLinkedListUnlink(LinkedListItem_t *pxItem) {
 	__LinkedListItem_t *item = (__LinkedListItem_t *)pxItem;
@@ -32,7 +32,7 @@ void vLinkedListUnlink(LinkedListItem_t *pxItem) {
 		}
 	}
 	if(item != libNULL) {
-		item->ovn = (uint32_t)item;
+		item->ovn = (uint32_t)(size_t)item;
 		item->marker = 0;
 		item->next = item;
 		item->prev = item;
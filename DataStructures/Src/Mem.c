@@ -1,18 +1,178 @@
 #include "CodeLib.h"
 
-/* Copy memory to memory */
-void mem_cpy(void* dst, const void* src, size_t cnt)
+/* Machine word access, unaligned source is loaded by bytes on targets without unaligned access support */
+typedef size_t __attribute__((may_alias)) _MemWord_t;
+typedef size_t __attribute__((may_alias, aligned(1))) _MemUWord_t;
+
+#define _MEM_WORD_SIZE          sizeof(size_t)
+#define _MEM_WORD_MASK          (sizeof(size_t) - 1)
+
+/* Shorter blocks are not worth vector setup */
+#define _MEM_SIMD_THRESHOLD     64
+
+#ifdef CL_SIMD_X86
+
+CL_SIMD_TARGET("avx2")
+static size_t _uMemCpyAvx2(uint8_t *d, const uint8_t *s, size_t cnt)
 {
-	uint8_t *d = (uint8_t*)dst;
-	const uint8_t *s = (const uint8_t*)src;
+	size_t i = 0;
+	for (; i + 128 <= cnt; i += 128)
+	{
+		ClVec32_t v0 = *(const ClVec32u_t *)(s + i);
+		ClVec32_t v1 = *(const ClVec32u_t *)(s + i + 32);
+		ClVec32_t v2 = *(const ClVec32u_t *)(s + i + 64);
+		ClVec32_t v3 = *(const ClVec32u_t *)(s + i + 96);
+		*(ClVec32u_t *)(d + i) = v0;
+		*(ClVec32u_t *)(d + i + 32) = v1;
+		*(ClVec32u_t *)(d + i + 64) = v2;
+		*(ClVec32u_t *)(d + i + 96) = v3;
+	}
+	for (; i + 32 <= cnt; i += 32)
+	{
+		*(ClVec32u_t *)(d + i) = *(const ClVec32u_t *)(s + i);
+	}
+	return i;
+}
+
+CL_SIMD_TARGET("sse2")
+static size_t _uMemCpySse2(uint8_t *d, const uint8_t *s, size_t cnt)
+{
+	size_t i = 0;
+	for (; i + 64 <= cnt; i += 64)
+	{
+		ClVec16_t v0 = *(const ClVec16u_t *)(s + i);
+		ClVec16_t v1 = *(const ClVec16u_t *)(s + i + 16);
+		ClVec16_t v2 = *(const ClVec16u_t *)(s + i + 32);
+		ClVec16_t v3 = *(const ClVec16u_t *)(s + i + 48);
+		*(ClVec16u_t *)(d + i) = v0;
+		*(ClVec16u_t *)(d + i + 16) = v1;
+		*(ClVec16u_t *)(d + i + 32) = v2;
+		*(ClVec16u_t *)(d + i + 48) = v3;
+	}
+	for (; i + 16 <= cnt; i += 16)
+	{
+		*(ClVec16u_t *)(d + i) = *(const ClVec16u_t *)(s + i);
+	}
+	return i;
+}
 
-	if (dst != src) 
+CL_SIMD_TARGET("avx2")
+static size_t _uMemSetAvx2(uint8_t *d, uint8_t val, size_t cnt)
+{
+	ClVec32_t v = (ClVec32_t){0} + (char)val;
+	size_t i = 0;
+	for (; i + 32 <= cnt; i += 32)
+	{
+		*(ClVec32u_t *)(d + i) = v;
+	}
+	return i;
+}
+
+CL_SIMD_TARGET("sse2")
+static size_t _uMemSetSse2(uint8_t *d, uint8_t val, size_t cnt)
+{
+	ClVec16_t v = (ClVec16_t){0} + (char)val;
+	size_t i = 0;
+	for (; i + 16 <= cnt; i += 16)
+	{
+		*(ClVec16u_t *)(d + i) = v;
+	}
+	return i;
+}
+
+/* Return count of leading bytes known to be equal */
+CL_SIMD_TARGET("avx2")
+static size_t _uMemEqualAvx2(const uint8_t *a, const uint8_t *b, size_t cnt)
+{
+	size_t i = 0;
+	for (; i + 32 <= cnt; i += 32)
+	{
+		ClVec32_t eq = *(const ClVec32u_t *)(a + i) == *(const ClVec32u_t *)(b + i);
+		if ((uint32_t)__builtin_ia32_pmovmskb256(eq) != 0xFFFFFFFF) break;
+	}
+	return i;
+}
+
+CL_SIMD_TARGET("sse2")
+static size_t _uMemEqualSse2(const uint8_t *a, const uint8_t *b, size_t cnt)
+{
+	size_t i = 0;
+	for (; i + 16 <= cnt; i += 16)
+	{
+		ClVec16_t eq = *(const ClVec16u_t *)(a + i) == *(const ClVec16u_t *)(b + i);
+		if (__builtin_ia32_pmovmskb128(eq) != 0xFFFF) break;
+	}
+	return i;
+}
+
+#endif /* CL_SIMD_X86 */
+
+/* Forward copy, each chunk is loaded before it is stored, so it is safe for overlapped dst below src */
+static void _vMemCopyFwd(uint8_t *d, const uint8_t *s, size_t cnt)
+{
+#ifdef CL_SIMD_X86
+	if (cnt >= _MEM_SIMD_THRESHOLD)
 	{
-		while (cnt--) 
+		uint32_t features = ulClCpuFeatures();
+		size_t done = (features & CL_CPU_AVX2)? _uMemCpyAvx2(d, s, cnt):
+		              (features & CL_CPU_SSE2)? _uMemCpySse2(d, s, cnt): 0;
+		d += done;
+		s += done;
+		cnt -= done;
+	}
+#endif
+	if (cnt >= 2 * _MEM_WORD_SIZE)
+	{
+		while ((size_t)d & _MEM_WORD_MASK)
 		{
 			*d++ = *s++;
+			cnt--;
+		}
+		for (; cnt >= _MEM_WORD_SIZE; cnt -= _MEM_WORD_SIZE)
+		{
+			*(_MemWord_t *)d = *(const _MemUWord_t *)s;
+			d += _MEM_WORD_SIZE;
+			s += _MEM_WORD_SIZE;
 		}
 	}
+	while (cnt--)
+	{
+		*d++ = *s++;
+	}
+}
+
+/* Backward copy from the end, safe for overlapped dst above src */
+static void _vMemCopyBwd(uint8_t *d, const uint8_t *s, size_t cnt)
+{
+	d += cnt;
+	s += cnt;
+	if (cnt >= 2 * _MEM_WORD_SIZE)
+	{
+		while ((size_t)d & _MEM_WORD_MASK)
+		{
+			*--d = *--s;
+			cnt--;
+		}
+		for (; cnt >= _MEM_WORD_SIZE; cnt -= _MEM_WORD_SIZE)
+		{
+			d -= _MEM_WORD_SIZE;
+			s -= _MEM_WORD_SIZE;
+			*(_MemWord_t *)d = *(const _MemUWord_t *)s;
+		}
+	}
+	while (cnt--)
+	{
+		*--d = *--s;
+	}
+}
+
+/* Copy memory to memory */
+void mem_cpy(void* dst, const void* src, size_t cnt)
+{
+	if (dst != src)
+	{
+		_vMemCopyFwd((uint8_t *)dst, (const uint8_t *)src, cnt);
+	}
 }
 
 /* Move memory to memory */
@@ -20,19 +180,16 @@ void mem_move(void* dst, const void* src, size_t cnt)
 {
 	if (src != dst && cnt != 0)
 	{
-		size_t dif = src - dst;
-		if (dif > 0 || -dif >= cnt)
+		uint8_t *d = (uint8_t *)dst;
+		const uint8_t *s = (const uint8_t *)src;
+		if ((size_t)(d - s) >= cnt)
 		{
-			mem_cpy(dst, src, cnt);
+			/* dst is below src or blocks do not overlap */
+			_vMemCopyFwd(d, s, cnt);
 		}
 		else
 		{
-			uint8_t *d = (uint8_t *)(dst + cnt - 1);
-			const uint8_t *s = (const uint8_t *)(src + cnt - 1);
-			while (cnt--)
-			{
-				*d-- = *s--;
-			}
+			_vMemCopyBwd(d, s, cnt);
 		}
 	}
 }
@@ -41,6 +198,30 @@ void mem_move(void* dst, const void* src, size_t cnt)
 void mem_set(void* dst, uint8_t val, size_t cnt)
 {
 	uint8_t *d = (uint8_t*)dst;
+#ifdef CL_SIMD_X86
+	if (cnt >= _MEM_SIMD_THRESHOLD)
+	{
+		uint32_t features = ulClCpuFeatures();
+		size_t done = (features & CL_CPU_AVX2)? _uMemSetAvx2(d, val, cnt):
+		              (features & CL_CPU_SSE2)? _uMemSetSse2(d, val, cnt): 0;
+		d += done;
+		cnt -= done;
+	}
+#endif
+	if (cnt >= 2 * _MEM_WORD_SIZE)
+	{
+		size_t pattern = ((size_t)-1 / 0xFF) * val;
+		while ((size_t)d & _MEM_WORD_MASK)
+		{
+			*d++ = val;
+			cnt--;
+		}
+		for (; cnt >= _MEM_WORD_SIZE; cnt -= _MEM_WORD_SIZE)
+		{
+			*(_MemWord_t *)d = pattern;
+			d += _MEM_WORD_SIZE;
+		}
+	}
 	while (cnt--)
 	{
 		*d++ = val;
@@ -49,16 +230,37 @@ void mem_set(void* dst, uint8_t val, size_t cnt)
 
 
 /* Compare memory block */
-int8_t mem_cmp(const void* dst, const void* src, size_t cnt)	/* ZR:same, NZ:different */
+int8_t mem_cmp(const void* dst, const void* src, size_t cnt)	/* ZR:same, <0: dst less, >0: dst greater */
 {
-	int8_t r = 0;
-	if (dst != src && cnt != 0)
+	if (dst == src)
+	{
+		return 0;
+	}
+	const uint8_t *d = (const uint8_t *)dst, *s = (const uint8_t *)src;
+#ifdef CL_SIMD_X86
+	if (cnt >= _MEM_SIMD_THRESHOLD)
 	{
-		const uint8_t *d = (const uint8_t *)dst, *s = (const uint8_t *)src;
-		do 
+		uint32_t features = ulClCpuFeatures();
+		size_t equal = (features & CL_CPU_AVX2)? _uMemEqualAvx2(d, s, cnt):
+		               (features & CL_CPU_SSE2)? _uMemEqualSse2(d, s, cnt): 0;
+		d += equal;
+		s += equal;
+		cnt -= equal;
+	}
+#endif
+	/* Skip equal words, first different byte is found bytewise */
+	for (; cnt >= _MEM_WORD_SIZE; cnt -= _MEM_WORD_SIZE)
+	{
+		if (*(const _MemUWord_t *)d != *(const _MemUWord_t *)s) break;
+		d += _MEM_WORD_SIZE;
+		s += _MEM_WORD_SIZE;
+	}
+	for (; cnt != 0; cnt--, d++, s++)
+	{
+		if (*d != *s)
 		{
-			r = *d++ -*s++;
-		} while (--cnt && r == 0);
+			return (*d < *s)? -1: 1;
+		}
 	}
-	return r;
+	return 0;
 }
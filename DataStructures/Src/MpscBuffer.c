@@ -0,0 +1,198 @@
+#include "CodeLib.h"
+
+#define MPSCB_VALIDATION_NUMBER 0xCAB5CB00
+
+/* Publishing producer waits for claims before it, let preempted claimant run */
+#if defined(CL_MPSC_BUFFER_SCHED_YIELD)
+#include <sched.h>
+#define _MPSC_BUFFER_YIELD()    sched_yield()
+#elif defined(CL_MPSC_BUFFER_YIELD)
+#define _MPSC_BUFFER_YIELD()    CL_MPSC_BUFFER_YIELD()
+#else
+#define _MPSC_BUFFER_YIELD()
+#endif
+
+/*
+  Indices are free running, data space size is power of 2.
+  read <= commit <= reserve, reserve - read <= mask + 1
+ */
+typedef struct {
+	uint32_t reserve; /* claimed by producers */
+	uint32_t commit;  /* published to consumer */
+	uint32_t read;    /* released by consumer */
+	uint32_t mask;
+	uint32_t validation;
+	uint8_t buffer[];
+} _MpscBuffer_t;
+
+LIB_ASSERRT_STRUCTURE_CAST(_MpscBuffer_t, MpscBuffer_t, MPSC_BUFFER_DESCRIPTOR_SIZE, "MpscBuffer.h");
+
+static _MpscBuffer_t *_pxMpscBufferCastDescriptor(MpscBuffer_t *pxDescriptor) {
+	size_t ptr_align = (size_t)pxDescriptor;
+	ptr_align = (((ptr_align + 3) >> 2) << 2);
+	_MpscBuffer_t *desc = (_MpscBuffer_t *)ptr_align;
+	return ((desc == libNULL) || (desc->validation != MPSCB_VALIDATION_NUMBER))? libNULL: desc;
+}
+
+MpscBuffer_t *pxMpscBufferInit(uint8_t *pucBuffer, BufferSize_t uBufferSize) {
+	if ((uBufferSize < (sizeof(MpscBuffer_t) + 3 + 2)) || (pucBuffer == libNULL)) return libNULL;
+	size_t ptr_align = (size_t)pucBuffer;
+	ptr_align = (((ptr_align + 3) >> 2) << 2);
+	_MpscBuffer_t *desc = (_MpscBuffer_t *)ptr_align;
+	uint32_t size = uBufferSize - (ptr_align - (size_t)pucBuffer) - sizeof(MpscBuffer_t);
+	while (!CL_IS_A_POWER_OF_2(size)) {
+		size &= size - 1;
+	}
+	desc->reserve = desc->commit = desc->read = 0;
+	desc->mask = size - 1;
+	__atomic_store_n(&desc->validation, MPSCB_VALIDATION_NUMBER, __ATOMIC_RELEASE);
+	return (MpscBuffer_t *)desc;
+}
+
+int32_t lMpscBufferAvailable(MpscBuffer_t *pxDescriptor) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL) {
+		return -1;
+	}
+	uint32_t commit = __atomic_load_n(&desc->commit, __ATOMIC_ACQUIRE);
+	return commit - __atomic_load_n(&desc->read, __ATOMIC_RELAXED);
+}
+
+int32_t lMpscBufferFree(MpscBuffer_t *pxDescriptor) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL) {
+		return -1;
+	}
+	uint32_t read = __atomic_load_n(&desc->read, __ATOMIC_ACQUIRE);
+	return desc->mask + 1 - (__atomic_load_n(&desc->reserve, __ATOMIC_RELAXED) - read);
+}
+
+int32_t lMpscBufferRead(MpscBuffer_t *pxDescriptor, uint8_t *pucOutBuf, BufferSize_t uCount, BufferSize_t uSkip, uint8_t bPeek) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL || pucOutBuf == libNULL) {
+		return -1;
+	}
+	uint32_t read = desc->read;
+	uint32_t dataCount = __atomic_load_n(&desc->commit, __ATOMIC_ACQUIRE) - read;
+	uSkip = CL_MIN(uSkip, dataCount);
+	read += uSkip;
+	dataCount -= uSkip;
+	uint32_t res = CL_MIN(uCount, dataCount);
+	uint32_t pos = read & desc->mask;
+	uint32_t chunk = CL_MIN(res, desc->mask + 1 - pos);
+	mem_cpy(pucOutBuf, &desc->buffer[pos], chunk);
+	mem_cpy(pucOutBuf + chunk, desc->buffer, res - chunk);
+	if (!bPeek) {
+		__atomic_store_n(&desc->read, read + res, __ATOMIC_RELEASE);
+	}
+	return res + uSkip;
+}
+
+static BufferSize_t _uMpscBufferStrLen(const uint8_t *pucData, BufferSize_t uMax) {
+	BufferSize_t len = 0;
+	while ((len < uMax) && (pucData[len] != '\0')) {
+		len++;
+	}
+	return len;
+}
+
+/* Claim with compare and exchange: unlike fetch-add, a claim larger than free space is never taken */
+static int32_t _lMpscBufferClaim(_MpscBuffer_t *pxDesc, uint32_t ulCount, uint8_t bAllOrNothing, uint32_t *pulHead) {
+	uint32_t res;
+	uint32_t head = __atomic_load_n(&pxDesc->reserve, __ATOMIC_RELAXED);
+	do {
+		uint32_t space = pxDesc->mask + 1 - (head - __atomic_load_n(&pxDesc->read, __ATOMIC_ACQUIRE));
+		res = CL_MIN(ulCount, space);
+		if (bAllOrNothing && (res != ulCount)) {
+			return -1;
+		}
+		if (res == 0) {
+			return 0;
+		}
+	} while (!__atomic_compare_exchange_n(&pxDesc->reserve, &head, head + res, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+	*pulHead = head;
+	return res;
+}
+
+/* Publish in claim order, wait for producers claimed space before */
+static void _vMpscBufferPublish(_MpscBuffer_t *pxDesc, uint32_t ulHead, uint32_t ulCount) {
+	while (__atomic_load_n(&pxDesc->commit, __ATOMIC_ACQUIRE) != ulHead) {
+		_MPSC_BUFFER_YIELD();
+	}
+	__atomic_store_n(&pxDesc->commit, ulHead + ulCount, __ATOMIC_RELEASE);
+}
+
+int32_t lMpscBufferWrite(MpscBuffer_t *pxDescriptor, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFillMode, uint8_t bAllOrNothing, uint8_t bStringMode) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL || pucData == libNULL) {
+		return -1;
+	}
+	if (bStringMode) {
+		/* Terminator is not copied, it ends the request */
+		uCount = bFillMode? ((*pucData == '\0')? 0: uCount): _uMpscBufferStrLen(pucData, uCount);
+	}
+	if (uCount == 0) {
+		return 0;
+	}
+	uint32_t head;
+	int32_t res = _lMpscBufferClaim(desc, uCount, bAllOrNothing, &head);
+	if (res <= 0) {
+		return res;
+	}
+	uint32_t pos = head & desc->mask;
+	uint32_t chunk = CL_MIN((uint32_t)res, desc->mask + 1 - pos);
+	if (bFillMode) {
+		mem_set(&desc->buffer[pos], *pucData, chunk);
+		mem_set(desc->buffer, *pucData, res - chunk);
+	}
+	else {
+		mem_cpy(&desc->buffer[pos], pucData, chunk);
+		mem_cpy(desc->buffer, pucData + chunk, res - chunk);
+	}
+	_vMpscBufferPublish(desc, head, res);
+	return res;
+}
+
+int32_t lMpscBufferClaim(MpscBuffer_t *pxDescriptor, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc == libNULL || apucSpans == libNULL || pulTicket == libNULL) {
+		return -1;
+	}
+	apucSpans[0] = apucSpans[1] = libNULL;
+	*pulTicket = 0;
+	if (uCount == 0) {
+		return 0;
+	}
+	uint32_t head;
+	if (_lMpscBufferClaim(desc, uCount, 1, &head) < 0) {
+		return -1;
+	}
+	uint32_t pos = head & desc->mask;
+	apucSpans[0] = &desc->buffer[pos];
+	apucSpans[1] = desc->buffer;
+	*pulTicket = head;
+	return CL_MIN(uCount, desc->mask + 1 - pos);
+}
+
+void vMpscBufferPublish(MpscBuffer_t *pxDescriptor, uint32_t ulTicket, BufferSize_t uCount) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if ((desc != libNULL) && (uCount != 0)) {
+		_vMpscBufferPublish(desc, ulTicket, uCount);
+	}
+}
+
+void vMpscBufferFlush(MpscBuffer_t *pxDescriptor) {
+	_MpscBuffer_t *desc = _pxMpscBufferCastDescriptor(pxDescriptor);
+	if (desc != libNULL) {
+		__atomic_store_n(&desc->read, __atomic_load_n(&desc->commit, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+	}
+}
+
+mpsc_buffer_t *mpsc_buffer_init(uint8_t *buffer, buffer_size_t buffer_size) __attribute__ ((alias ("pxMpscBufferInit")));
+int32_t mpsc_buffer_available(mpsc_buffer_t *desc) __attribute__ ((alias ("lMpscBufferAvailable")));
+int32_t mpsc_buffer_free(mpsc_buffer_t *desc) __attribute__ ((alias ("lMpscBufferFree")));
+int32_t mpsc_buffer_read(mpsc_buffer_t *desc, uint8_t *dest, buffer_size_t count, buffer_size_t skip, uint8_t to_peek) __attribute__ ((alias ("lMpscBufferRead")));
+int32_t mpsc_buffer_write(mpsc_buffer_t *desc, const uint8_t *data, buffer_size_t count, uint8_t to_fill, uint8_t put_all, uint8_t as_string) __attribute__ ((alias ("lMpscBufferWrite")));
+int32_t mpsc_buffer_claim(mpsc_buffer_t *desc, buffer_size_t count, uint8_t *spans[2], uint32_t *ticket) __attribute__ ((alias ("lMpscBufferClaim")));
+void mpsc_buffer_publish(mpsc_buffer_t *desc, uint32_t ticket, buffer_size_t count) __attribute__ ((alias ("vMpscBufferPublish")));
+void mpsc_buffer_flush(mpsc_buffer_t *desc) __attribute__ ((alias ("vMpscBufferFlush")));
@@ -101,10 +101,10 @@ static void _vPrintfParseFlags(const char* pcFormat, uint32_t *pulCursor, uint32
 	@param[in]pcFormat			Pointer to format string
 	@param[in/out]pulCursor		Current offset in format string
 	@param[in/out]pulOptions	Format options
-	@param[in]xArgs				Pointer to format arguments
+	@param[in/out]pxArgs		Pointer to format arguments, advanced if width is an argument
 	@return 0 or width if present
 */
-static int32_t _lPrintfParseWidth(const char* pcFormat, uint32_t *pulCursor, uint32_t *pulOptions, va_list xArgs) {
+static int32_t _lPrintfParseWidth(const char* pcFormat, uint32_t *pulCursor, uint32_t *pulOptions, va_list *pxArgs) {
 	/* Width */
 	uint8_t symbol = pcFormat[*pulCursor];
 	int32_t width = 0;
@@ -113,7 +113,7 @@ static int32_t _lPrintfParseWidth(const char* pcFormat, uint32_t *pulCursor, uin
 	   even if the result is larger. */
 	if (symbol == '*') { /* The width is not specified in the format string, but as an additional integer value argument
 						    preceding the argument that has to be formatted. */
-		width = va_arg(xArgs, int);
+		width = va_arg(*pxArgs, int);
 		if (width < 0) {
 			*pulOptions |= PRINTF_FLAG_ALIGNMENT_LEFT;
 			width = -width;
@@ -137,10 +137,10 @@ static int32_t _lPrintfParseWidth(const char* pcFormat, uint32_t *pulCursor, uin
 	@param[in]pcFormat			Pointer to format string
 	@param[in/out]pulCursor		Current offset in format string
 	@param[in/out]pulOptions	Format options
-	@param[in]xArgs				Pointer to format arguments
+	@param[in/out]pxArgs		Pointer to format arguments, advanced if precision is an argument
 	@return 0 or precision if present
 */
-static int32_t _lPrintfParsePrecision(const char* pcFormat, uint32_t *pulCursor, uint32_t *pulOptions, va_list xArgs) {
+static int32_t _lPrintfParsePrecision(const char* pcFormat, uint32_t *pulCursor, uint32_t *pulOptions, va_list *pxArgs) {
 	/* Precision */
 	uint8_t symbol = pcFormat[*pulCursor];
 	int32_t precision = 0;
@@ -160,7 +160,7 @@ static int32_t _lPrintfParsePrecision(const char* pcFormat, uint32_t *pulCursor,
 		symbol = pcFormat[*pulCursor];
 		if (symbol == '*') { /* The precision is not specified in the format string, but as an additional integer
 							    value argument preceding the argument that has to be formatted. */
-			precision = va_arg(xArgs, int32_t);
+			precision = va_arg(*pxArgs, int32_t);
 			if (precision < 0) {
 				precision = 0;
 				*pulOptions &= ~PRINTF_PRECISION_PRESENT;
@@ -267,12 +267,10 @@ static void _vPrintfParseSpecifier(const char* pcFormat, uint32_t *pulCursor, ui
 static int32_t _lPrintfPrintString(PrintfWriter_t pfWriter, void *pxWrContext, uint8_t *pcString, uint32_t ulCount, int32_t lWidth, uint32_t ulOptions) {
 	//if (flags & PRINTF_LENGTH_LONG) //yet unsuported wchar string
 	if(pcString == libNULL) return -1;
-	int32_t strLength = 0;
-	while (pcString[strLength] != '\0') strLength++;
+	/* Not more than precision symbols are read, so not terminated string views can be printed with "%.*s" */
+	int32_t strLength = lStrnLen((const char *)pcString, (ulOptions & PRINTF_PRECISION_PRESENT)? (int32_t)ulCount: 0x7FFFFFFF);
 	int32_t streamed = 0;
 	int32_t result = 0;
-	if (ulOptions & PRINTF_PRECISION_PRESENT)
-		strLength = (strLength > (int32_t)ulCount) ? (int32_t)ulCount : strLength;
 	lWidth -= strLength;
 	int32_t stage = 0;
 	if (ulOptions & PRINTF_FLAG_ALIGNMENT_LEFT) stage = 2;
@@ -569,11 +567,24 @@ static int32_t _lPrintInteger(PrintfWriter_t pfWriter, void *pxWrContext, uint64
 		prefix[2] = '\0';
 		lWidth--;
 	}
-	int32_t intLen = 1;
-	uint64_t tmp = ullValue / notation;
-	while (tmp > 0) {
-		tmp /= notation;
-		intLen++;
+	uint8_t integerStr[64]; /* Binary 64 bit value is the longest */
+	int32_t intLen;
+	if (notation == 10) {
+		intLen = lULongLongToStr((char *)integerStr, ullValue);
+	}
+	else { /* Power of 2 notation, digits are taken with shifts */
+		const char *digits = (ulOptions & PRINTF_SPECIFIER_UPPER_CASE)? "0123456789ABCDEF": "0123456789abcdef";
+		uint32_t shift = (notation == 2)? 1: (notation == 8)? 3: 4;
+		uint64_t tmp = ullValue >> shift;
+		intLen = 1;
+		while (tmp > 0) {
+			tmp >>= shift;
+			intLen++;
+		}
+		for (int32_t i = intLen - 1; i >= 0; i--) {
+			integerStr[i] = digits[ullValue & (notation - 1)];
+			ullValue >>= shift;
+		}
 	}
 	lWidth -= intLen;
 	if (ulOptions & PRINTF_PRECISION_PRESENT) {
@@ -603,23 +614,8 @@ static int32_t _lPrintInteger(PrintfWriter_t pfWriter, void *pxWrContext, uint64
 			case 2:
 				if (lPrecision > 0) result = _lFillWith(pfWriter, pxWrContext, '0', lPrecision);
 				break;
-			case 3: {
-					uint8_t integerStr[intLen];
-					uint8_t integerIndex = intLen;
-					uint8_t digit;
-					do {
-						digit = ullValue % notation;
-						if (digit > 9) {
-							if (ulOptions & PRINTF_SPECIFIER_UPPER_CASE) digit +=  'A' - 10;
-							else digit +=  'a' - 10;
-						}
-						else digit += '0';
-						integerStr[--integerIndex] = digit;
-						result++;
-						ullValue /= notation;
-					} while (integerIndex);
-					result = pfWriter(pxWrContext, integerStr, intLen);
-				}
+			case 3:
+				result = pfWriter(pxWrContext, integerStr, intLen);
 				break;
 			case 4:
 				if (ulOptions & PRINTF_FLAG_ALIGNMENT_LEFT && lWidth > 0) 
@@ -658,6 +654,9 @@ int32_t lClVPrintf(PrintfWriter_t pfWriter, void *pxWrContext, const char* pcFor
     int32_t streamed = 0;
     int32_t result;
     uint32_t cursor = 0;
+    /* Local copy is advanced by the parsing helpers, va_list passed by value is not */
+    va_list args;
+    va_copy(args, xArgs);
     while (pcFormat[cursor] != '\0') {
         result = 0;
 		uint32_t from = cursor;
@@ -673,40 +672,40 @@ int32_t lClVPrintf(PrintfWriter_t pfWriter, void *pxWrContext, const char* pcFor
 				int32_t width, precision;
                 width = precision = options = 0;
                 _vPrintfParseFlags(pcFormat, &cursor, &options);
-                width = _lPrintfParseWidth(pcFormat, &cursor, &options, xArgs);
-                precision = _lPrintfParsePrecision(pcFormat, &cursor, &options, xArgs);
+                width = _lPrintfParseWidth(pcFormat, &cursor, &options, &args);
+                precision = _lPrintfParsePrecision(pcFormat, &cursor, &options, &args);
                 _vPrintfParseLength(pcFormat, &cursor, &options);
                 _vPrintfParseSpecifier(pcFormat, &cursor, &options);
                 if (!(options & PRINTF_TYPE_UNKNOWN)) { /* Format recognized, print parameter. Else unknown type, pass-through */
                     if (options & PRINTF_TYPE_CHARACTER) {
-                        int32_t symb = (uint8_t)va_arg(xArgs, int32_t);
+                        int32_t symb = (uint8_t)va_arg(args, int32_t);
                         result = _lPrintfPrintString(pfWriter, pxWrContext, (uint8_t*)&symb, 1, width, options);
                     }
                     else if (options & PRINTF_TYPE_STRING) {
-						uint8_t *str = va_arg(xArgs, uint8_t*);
-						if(*str == '\0') continue;
+						uint8_t *str = va_arg(args, uint8_t*);
+						if(((options & PRINTF_PRECISION_PRESENT) && (precision == 0)) || (*str == '\0')) continue;
                         result = _lPrintfPrintString(pfWriter, pxWrContext, str, precision, width, options);
 					}
                     else if (options & PRINTF_TYPE_DOUBLE || options & PRINTF_TYPE_DOUBLE_SCIENTIFIC) {
-                        float fValue = (float)va_arg(xArgs, double);
+                        float fValue = (float)va_arg(args, double);
                         result = _lPrintFloat(pfWriter, pxWrContext, fValue, options, width, precision);
                     }
                     else { /* Print decimal */
                         uint64_t value;
                         switch (options & PRINTF_LENGTH_MASK) {
                         case PRINTF_LENGTH_LONG_LONG:
-                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(xArgs, int64_t);
-                            else value = va_arg(xArgs, uint64_t);
+                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(args, int64_t);
+                            else value = va_arg(args, uint64_t);
                             break;
                         case PRINTF_LENGTH_LONG:
-                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(xArgs, int32_t);
-                            else value = (uint64_t)va_arg(xArgs, uint32_t);
+                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(args, int32_t);
+                            else value = (uint64_t)va_arg(args, uint32_t);
                             break;
                         case PRINTF_LENGTH_CHAR:
                         case PRINTF_LENGTH_SHORT:
                         default:
-                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(xArgs, int32_t);
-                            else value = (uint64_t)va_arg(xArgs, uint32_t);
+                            if (options & PRINTF_TYPE_SIGNED) value = (uint64_t)va_arg(args, int32_t);
+                            else value = (uint64_t)va_arg(args, uint32_t);
                             break;
                         }
                         result = _lPrintInteger(pfWriter, pxWrContext, value, options, width, precision);
@@ -717,6 +716,7 @@ int32_t lClVPrintf(PrintfWriter_t pfWriter, void *pxWrContext, const char* pcFor
         if (result <= 0) break;
         streamed += result;
     }
+    va_end(args);
     return streamed;
 }
 
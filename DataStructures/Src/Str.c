@@ -1,39 +1,126 @@
 #include "CodeLib.h"
 
-#define MAX_DIGITS_IN_LONG_INT	11
+/* Word-at-a-time scan, word loads are aligned so they never cross page boundary */
+typedef size_t _StrWord_t __attribute__((may_alias));
 
-static int32_t _strnCpy(char *pcBuffer, int32_t lCount, const char *pcStr) {
-	int32_t copiedCount = 0;
-	while (*pcStr != '\0' && ((lCount > 0 && copiedCount < lCount - 1) || lCount == 0)) {
-		*pcBuffer = *pcStr;
-		pcBuffer++;
-		pcStr++;
-		copiedCount++;
+#define _STR_WORD_SIZE          sizeof(_StrWord_t)
+#define _STR_WORD_MASK          (sizeof(_StrWord_t) - 1)
+#define _STR_ONES               ((_StrWord_t)-1 / 0xFF)
+#define _STR_HAS_ZERO(w)        (((w) - _STR_ONES) & ~(w) & (_STR_ONES << 7))
+#define _STR_UNLIMITED          0x7FFFFFFF
+/* Smallest page size, unaligned vector load is done only if it ends in the same page */
+#define _STR_PAGE_SIZE          4096
+#define _STR_IN_PAGE(p, n)      (((size_t)(p) & (_STR_PAGE_SIZE - 1)) <= (_STR_PAGE_SIZE - (n)))
+
+#ifdef CL_SIMD_X86
+
+/* Aligned blocks are loaded, bytes before string start are shifted out of the mask */
+CL_SIMD_TARGET("sse2")
+static uint32_t _ulStrnLenSse2(const char *pcStr, uint32_t ulMax) {
+	const char *block = (const char *)((size_t)pcStr & ~(size_t)15);
+	uint32_t offset = pcStr - block;
+	uint32_t mask = __builtin_ia32_pmovmskb128(*(const ClVec16u_t *)block == 0) >> offset;
+	if (mask) {
+		return CL_MIN((uint32_t)__builtin_ctz(mask), ulMax);
+	}
+	for (uint32_t length = 16 - offset; length < ulMax; length += 16) {
+		block += 16;
+		mask = __builtin_ia32_pmovmskb128(*(const ClVec16u_t *)block == 0);
+		if (mask) {
+			return CL_MIN(length + __builtin_ctz(mask), ulMax);
+		}
+	}
+	return ulMax;
+}
+
+CL_SIMD_TARGET("sse2")
+static uint32_t _ulStrMatchSse2(const char *pcStr1, const char *pcStr2, uint32_t ulMax) {
+	uint32_t i = 0;
+	while (i < ulMax) {
+		if ((i + 16 <= ulMax) && _STR_IN_PAGE(pcStr1 + i, 16) && _STR_IN_PAGE(pcStr2 + i, 16)) {
+			ClVec16_t a = *(const ClVec16u_t *)(pcStr1 + i);
+			ClVec16_t b = *(const ClVec16u_t *)(pcStr2 + i);
+			uint32_t mask = __builtin_ia32_pmovmskb128((a != b) | (a == 0));
+			if (mask) {
+				return i + __builtin_ctz(mask);
+			}
+			i += 16;
+		}
+		else {
+			if ((pcStr1[i] != pcStr2[i]) || (pcStr1[i] == '\0')) {
+				return i;
+			}
+			i++;
+		}
+	}
+	return ulMax;
+}
+
+#endif /* CL_SIMD_X86 */
+
+/* Length of string but not more than ulMax */
+static uint32_t _ulStrnLen(const char *pcStr, uint32_t ulMax) {
+#ifdef CL_SIMD_X86
+	if (ulClCpuFeatures() & CL_CPU_SSE2) {
+		return _ulStrnLenSse2(pcStr, ulMax);
+	}
+#endif
+	uint32_t length = 0;
+	for (; (length < ulMax) && ((size_t)(pcStr + length) & _STR_WORD_MASK); length++) {
+		if (pcStr[length] == '\0') {
+			return length;
+		}
+	}
+	for (; (length + _STR_WORD_SIZE <= ulMax) && !_STR_HAS_ZERO(*(const _StrWord_t *)(pcStr + length)); length += _STR_WORD_SIZE);
+	for (; (length < ulMax) && (pcStr[length] != '\0'); length++);
+	return length;
+}
+
+/* Index of first different char or string end, but not more than ulMax */
+static uint32_t _ulStrMatch(const char *pcStr1, const char *pcStr2, uint32_t ulMax) {
+#ifdef CL_SIMD_X86
+	if (ulClCpuFeatures() & CL_CPU_SSE2) {
+		return _ulStrMatchSse2(pcStr1, pcStr2, ulMax);
+	}
+#endif
+	uint32_t i = 0;
+	/* Words are compared only if both strings get aligned at once */
+	if (!(((size_t)pcStr1 ^ (size_t)pcStr2) & _STR_WORD_MASK)) {
+		for (; (i < ulMax) && ((size_t)(pcStr1 + i) & _STR_WORD_MASK); i++) {
+			if ((pcStr1[i] != pcStr2[i]) || (pcStr1[i] == '\0')) {
+				return i;
+			}
+		}
+		for (; i + _STR_WORD_SIZE <= ulMax; i += _STR_WORD_SIZE) {
+			_StrWord_t word = *(const _StrWord_t *)(pcStr1 + i);
+			if ((word != *(const _StrWord_t *)(pcStr2 + i)) || _STR_HAS_ZERO(word)) {
+				break;
+			}
+		}
 	}
-	*pcBuffer = '\0';
+	for (; (i < ulMax) && (pcStr1[i] == pcStr2[i]) && (pcStr1[i] != '\0'); i++);
+	return i;
+}
+
+static int32_t _strnCpy(char *pcBuffer, int32_t lCount, const char *pcStr) {
+	uint32_t copiedCount = _ulStrnLen(pcStr, (lCount == 0)? _STR_UNLIMITED: (lCount > 0)? lCount - 1: 0);
+	mem_cpy(pcBuffer, pcStr, copiedCount);
+	pcBuffer[copiedCount] = '\0';
 	return copiedCount;
 }
 
+/* Count of equal chars plus one, no more than lCompareCount if it is above 1, negative if pcStr1 is less */
 static int32_t _strnCmp(const char *pcStr1, const char *pcStr2, int32_t lCompareCount) {
-	int32_t comparedCount = 1;
-	while (*pcStr1 != '\0' && *pcStr2 != '\0' && *pcStr1 == *pcStr2) {
-		pcStr1++;
-		pcStr2++;
-		comparedCount++;
-		if (comparedCount == lCompareCount)
-			break;
-	}
-	return (*pcStr1 < *pcStr2) ? -comparedCount : comparedCount;
+	uint32_t matched = _ulStrMatch(pcStr1, pcStr2, (lCompareCount > 1)? lCompareCount - 1: _STR_UNLIMITED);
+	int32_t comparedCount = matched + 1;
+	return (pcStr1[matched] < pcStr2[matched]) ? -comparedCount : comparedCount;
 }
 
 int32_t lStrLen(const char *pcStr) {
-	int32_t length = -1;
 	if (pcStr != libNULL) {
-		while (++length, *pcStr != '\0') {
-			pcStr++;
-		}
+		return _ulStrnLen(pcStr, _STR_UNLIMITED);
 	}
-	return length;
+	return -1;
 }
 
 int32_t lStrCmp(const char *pcStr1, const char *pcStr2) {
@@ -90,133 +177,530 @@ int32_t lStrCat(char *pcBuffer, const char *pcStr1, const char *pcStr2) {
 	return length;
 }
 
-int32_t lStrSrc(const char *pcStr1, const char *pcStr2) {
-	if (pcStr1 != libNULL && pcStr2 != libNULL  && *pcStr1 != '\0' && *pcStr2 != '\0') {
-		int32_t comparedCount = 0;
-		int32_t offset = 0;
-		while (pcStr1[offset] != '\0') {
-			if (&(pcStr1[offset]) == pcStr2) {
-				return offset;
-			}
-			comparedCount = _strnCmp(&(pcStr1[offset]), pcStr2, 0);
-			if (comparedCount > 0 && pcStr2[comparedCount - 1] == '\0') {
-				return offset;
+/* Horspool shift by the last window char, needles longer than 255 get shorter but still safe shifts */
+static void _vStrShiftTable(uint8_t *pucShift, const char *pcNeedle, uint32_t ulLength) {
+	mem_set(pucShift, CL_MIN(ulLength, 0xFF), 256);
+	for (uint32_t i = 0; i + 1 < ulLength; i++) {
+		pucShift[(uint8_t)pcNeedle[i]] = CL_MIN(ulLength - 1 - i, 0xFF);
+	}
+}
+
+/* Backward Horspool shift by the first window char */
+static void _vStrShiftLastTable(uint8_t *pucShift, const char *pcNeedle, uint32_t ulLength) {
+	mem_set(pucShift, CL_MIN(ulLength, 0xFF), 256);
+	for (uint32_t i = ulLength - 1; i > 0; i--) {
+		pucShift[(uint8_t)pcNeedle[i]] = CL_MIN(i, 0xFF);
+	}
+}
+
+#ifdef CL_SIMD_X86
+
+/* Candidate positions are the ones where the first and the last needle chars match, 16 positions per step */
+CL_SIMD_TARGET("sse2")
+static int32_t _lStrFindSse2(const char *pcStr, uint32_t ulLength, const char *pcNeedle, uint32_t ulNeedleLength, uint32_t *pulScanned) {
+	ClVec16_t first = (ClVec16_t){0} + pcNeedle[0];
+	ClVec16_t last = (ClVec16_t){0} + pcNeedle[ulNeedleLength - 1];
+	uint32_t i = 0;
+	for (; i + ulNeedleLength + 15 <= ulLength; i += 16) {
+		uint32_t mask = __builtin_ia32_pmovmskb128((*(const ClVec16u_t *)(pcStr + i) == first) &
+		                                           (*(const ClVec16u_t *)(pcStr + i + ulNeedleLength - 1) == last));
+		for (; mask; mask &= mask - 1) {
+			uint32_t pos = i + __builtin_ctz(mask);
+			if (mem_cmp(pcStr + pos, pcNeedle, ulNeedleLength) == 0) {
+				return pos;
 			}
-			offset++;
 		}
 	}
+	*pulScanned = i;
 	return -1;
 }
 
-int32_t lStrnSrc(const char *pcStr1, int32_t lLength, const char *pcStr2) {
-	if (pcStr1 != libNULL && pcStr2 != libNULL && *pcStr1 != '\0' && *pcStr2 != '\0') {
-		int32_t comparedCount = 0;
-		int32_t offset = 0;
-		int32_t str2Len = lStrLen(pcStr2);
-		str2Len = str2Len > lLength ? lLength : str2Len;
-		while (pcStr1[offset] != '\0' && lLength >= str2Len) {
-			comparedCount = _strnCmp(&(pcStr1[offset]), pcStr2, lLength);
-			if ((comparedCount > 0 && pcStr2[comparedCount - 1] == '\0') ||
-				(comparedCount == str2Len && pcStr2[comparedCount - 1] == pcStr1[offset + comparedCount - 1])) {
-				return offset;
+/* Same from the end, *pulCount holds count of positions from the beginning left to check */
+CL_SIMD_TARGET("sse2")
+static int32_t _lStrFindLastSse2(const char *pcStr, const char *pcNeedle, uint32_t ulNeedleLength, uint32_t *pulCount) {
+	ClVec16_t first = (ClVec16_t){0} + pcNeedle[0];
+	ClVec16_t last = (ClVec16_t){0} + pcNeedle[ulNeedleLength - 1];
+	uint32_t count = *pulCount;
+	for (; count >= 16; count -= 16) {
+		uint32_t i = count - 16;
+		uint32_t mask = __builtin_ia32_pmovmskb128((*(const ClVec16u_t *)(pcStr + i) == first) &
+		                                           (*(const ClVec16u_t *)(pcStr + i + ulNeedleLength - 1) == last));
+		while (mask) {
+			uint32_t bit = 31 - __builtin_clz(mask);
+			if (mem_cmp(pcStr + i + bit, pcNeedle, ulNeedleLength) == 0) {
+				return i + bit;
 			}
-			offset++;
-			lLength--;
+			mask &= ~(1UL << bit);
+		}
+	}
+	*pulCount = count;
+	return -1;
+}
+
+#endif /* CL_SIMD_X86 */
+
+/* Shift table is worth building for one-shot search only if there are enough positions to check */
+#define _STR_SHIFT_TABLE_MIN    64
+
+/* Check windows from position i forward, step by shift table if given */
+static inline int32_t _lStrScanFirst(const char *pcStr, uint32_t ulLength, const char *pcNeedle, uint32_t ulNeedleLength,
+                                     const uint8_t *pucShift, uint32_t i) {
+	char lastChar = pcNeedle[ulNeedleLength - 1];
+	while (i + ulNeedleLength <= ulLength) {
+		char c = pcStr[i + ulNeedleLength - 1];
+		if ((c == lastChar) && (mem_cmp(pcStr + i, pcNeedle, ulNeedleLength - 1) == 0)) {
+			return i;
+		}
+		i += (pucShift != libNULL)? pucShift[(uint8_t)c]: 1;
+	}
+	return -1;
+}
+
+/* One-shot long search, shift table lives in own frame, so short searches don't reserve its stack */
+static int32_t __attribute__((noinline)) _lStrScanFirstTable(const char *pcStr, uint32_t ulLength, const char *pcNeedle,
+                                                             uint32_t ulNeedleLength, uint32_t i) {
+	uint8_t shift[256];
+	_vStrShiftTable(shift, pcNeedle, ulNeedleLength);
+	return _lStrScanFirst(pcStr, ulLength, pcNeedle, ulNeedleLength, shift, i);
+}
+
+/* First entry of needle in string of known length, pucShift may be libNULL */
+static int32_t _lStrFindFirst(const char *pcStr, uint32_t ulLength, const char *pcNeedle, uint32_t ulNeedleLength, const uint8_t *pucShift) {
+	uint32_t i = 0;
+	if (ulNeedleLength > ulLength) {
+		return -1;
+	}
+#ifdef CL_SIMD_X86
+	if (ulClCpuFeatures() & CL_CPU_SSE2) {
+		int32_t found = _lStrFindSse2(pcStr, ulLength, pcNeedle, ulNeedleLength, &i);
+		if (found >= 0) {
+			return found;
+		}
+	}
+#endif
+	if ((pucShift == libNULL) && (ulLength - ulNeedleLength + 1 - i >= _STR_SHIFT_TABLE_MIN)) {
+		return _lStrScanFirstTable(pcStr, ulLength, pcNeedle, ulNeedleLength, i);
+	}
+	return _lStrScanFirst(pcStr, ulLength, pcNeedle, ulNeedleLength, pucShift, i);
+}
+
+/* Check count windows from the end backward, step by shift table if given */
+static inline int32_t _lStrScanLast(const char *pcStr, const char *pcNeedle, uint32_t ulNeedleLength,
+                                    const uint8_t *pucShift, uint32_t count) {
+	char firstChar = pcNeedle[0];
+	while (count) {
+		uint32_t i = count - 1;
+		char c = pcStr[i];
+		if ((c == firstChar) && (mem_cmp(pcStr + i + 1, pcNeedle + 1, ulNeedleLength - 1) == 0)) {
+			return i;
 		}
+		uint32_t step = (pucShift != libNULL)? pucShift[(uint8_t)c]: 1;
+		count = (count > step)? count - step: 0;
+	}
+	return -1;
+}
+
+static int32_t __attribute__((noinline)) _lStrScanLastTable(const char *pcStr, const char *pcNeedle, uint32_t ulNeedleLength,
+                                                            uint32_t count) {
+	uint8_t shift[256];
+	_vStrShiftLastTable(shift, pcNeedle, ulNeedleLength);
+	return _lStrScanLast(pcStr, pcNeedle, ulNeedleLength, shift, count);
+}
+
+/* Last entry of needle in string of known length, pucShift may be libNULL */
+static int32_t _lStrFindLast(const char *pcStr, uint32_t ulLength, const char *pcNeedle, uint32_t ulNeedleLength, const uint8_t *pucShift) {
+	if (ulNeedleLength > ulLength) {
+		return -1;
+	}
+	/* Count of window positions left to check, windows are checked from the end */
+	uint32_t count = ulLength - ulNeedleLength + 1;
+#ifdef CL_SIMD_X86
+	if (ulClCpuFeatures() & CL_CPU_SSE2) {
+		int32_t found = _lStrFindLastSse2(pcStr, pcNeedle, ulNeedleLength, &count);
+		if (found >= 0) {
+			return found;
+		}
+	}
+#endif
+	if ((pucShift == libNULL) && (count >= _STR_SHIFT_TABLE_MIN)) {
+		return _lStrScanLastTable(pcStr, pcNeedle, ulNeedleLength, count);
+	}
+	return _lStrScanLast(pcStr, pcNeedle, ulNeedleLength, pucShift, count);
+}
+
+int32_t lStrSrc(const char *pcStr1, const char *pcStr2) {
+	if (pcStr1 != libNULL && pcStr2 != libNULL  && *pcStr1 != '\0' && *pcStr2 != '\0') {
+		return _lStrFindFirst(pcStr1, _ulStrnLen(pcStr1, _STR_UNLIMITED), pcStr2, _ulStrnLen(pcStr2, _STR_UNLIMITED), libNULL);
+	}
+	return -1;
+}
+
+int32_t lStrnSrc(const char *pcStr1, int32_t lLength, const char *pcStr2) {
+	if (lLength > 0 && pcStr1 != libNULL && pcStr2 != libNULL && *pcStr1 != '\0' && *pcStr2 != '\0') {
+		return _lStrFindFirst(pcStr1, _ulStrnLen(pcStr1, lLength), pcStr2, _ulStrnLen(pcStr2, _STR_UNLIMITED), libNULL);
 	}
 	return -1;
 }
 
 int32_t lStrnSrcLast(const char *pcStr1, int32_t lLength, const char *pcStr2) {
 	if (lLength > 0 && pcStr1 != libNULL && pcStr2 != libNULL && *pcStr2 != '\0' && *pcStr1 != '\0') {
-		int32_t str1Len = lStrLen(pcStr1);
-		int32_t str2Len = lStrLen(pcStr2);
-		if (str2Len <= lLength && str2Len <= str1Len) {
-			const char *str1Cursor = libNULL, *str2Cursor = libNULL;
-			const char *str2End = pcStr2 + str2Len, *str1End = pcStr1 + CL_MIN(lLength, str1Len);
-			while (str1End != pcStr1) {
-				str1Cursor = --str1End;
-				str2Cursor = str2End - 1;
-				if (*str1Cursor == *str2Cursor) {
-					do {
-						if (str2Cursor == pcStr2) {
-							return (str1Cursor - pcStr1);
-						}
-						if (str1Cursor == pcStr1) {
-							return -1;
-						}
-						str1Cursor--;
-						str2Cursor--;
-					} while (*str1Cursor == *str2Cursor);
-				}
-			}
-		}
+		return _lStrFindLast(pcStr1, _ulStrnLen(pcStr1, lLength), pcStr2, _ulStrnLen(pcStr2, _STR_UNLIMITED), libNULL);
 	}
 	return -1;
 }
 
-int32_t lLongToStr(char *pcBufer, int32_t lValue) {
-	int32_t count = -1;
-	if (pcBufer != libNULL) {
-		if (lValue == -2147483648) {
-			count = lStrCpy(pcBufer, (const char *)"-2147483648"); 
+uint8_t bStrSearchInit(StrSearch_t *pxSearch, const char *pcNeedle) {
+	if (pxSearch == libNULL || pcNeedle == libNULL || *pcNeedle == '\0') {
+		return CL_FALSE;
+	}
+	pxSearch->pcNeedle = pcNeedle;
+	pxSearch->ulLength = _ulStrnLen(pcNeedle, _STR_UNLIMITED);
+	_vStrShiftTable(pxSearch->aucShift, pcNeedle, pxSearch->ulLength);
+	_vStrShiftLastTable(pxSearch->aucShiftLast, pcNeedle, pxSearch->ulLength);
+	return CL_TRUE;
+}
+
+int32_t lStrSearch(const StrSearch_t *pxSearch, const char *pcStr, int32_t lLength) {
+	if (pxSearch == libNULL || pcStr == libNULL || pxSearch->pcNeedle == libNULL) {
+		return -1;
+	}
+	uint32_t length = _ulStrnLen(pcStr, (lLength < 0)? _STR_UNLIMITED: (uint32_t)lLength);
+	return _lStrFindFirst(pcStr, length, pxSearch->pcNeedle, pxSearch->ulLength, pxSearch->aucShift);
+}
+
+int32_t lStrSearchLast(const StrSearch_t *pxSearch, const char *pcStr, int32_t lLength) {
+	if (pxSearch == libNULL || pcStr == libNULL || pxSearch->pcNeedle == libNULL) {
+		return -1;
+	}
+	uint32_t length = _ulStrnLen(pcStr, (lLength < 0)? _STR_UNLIMITED: (uint32_t)lLength);
+	return _lStrFindLast(pcStr, length, pxSearch->pcNeedle, pxSearch->ulLength, pxSearch->aucShiftLast);
+}
+
+int32_t lStrnLen(const char *pcStr, int32_t lMax) {
+	if (pcStr != libNULL) {
+		return _ulStrnLen(pcStr, (lMax < 0)? 0: lMax);
+	}
+	return -1;
+}
+
+StrView_t xStrView(const char *pcStr) {
+	if (pcStr == libNULL) {
+		return (StrView_t){ "", 0 };
+	}
+	return (StrView_t){ pcStr, _ulStrnLen(pcStr, _STR_UNLIMITED) };
+}
+
+int32_t lStrViewCmp(StrView_t xView1, StrView_t xView2) {
+	int32_t result = mem_cmp(xView1.pcStr, xView2.pcStr, CL_MIN(xView1.ulLength, xView2.ulLength));
+	if (result == 0 && xView1.ulLength != xView2.ulLength) {
+		result = (xView1.ulLength < xView2.ulLength)? -1: 1;
+	}
+	return result;
+}
+
+int32_t lStrViewCaseCmp(StrView_t xView1, StrView_t xView2) {
+	uint32_t length = CL_MIN(xView1.ulLength, xView2.ulLength);
+	for (uint32_t i = 0; i < length; i++) {
+		uint8_t c1 = TO_LOWER((uint8_t)xView1.pcStr[i]);
+		uint8_t c2 = TO_LOWER((uint8_t)xView2.pcStr[i]);
+		if (c1 != c2) {
+			return (c1 < c2)? -1: 1;
 		}
-		else if (lValue == 0) {
-			*pcBufer = '0';
-			++pcBufer;
-			*pcBufer = '\0';
-			count = 1;
+	}
+	if (xView1.ulLength != xView2.ulLength) {
+		return (xView1.ulLength < xView2.ulLength)? -1: 1;
+	}
+	return 0;
+}
+
+uint8_t bStrViewEqual(StrView_t xView1, StrView_t xView2) {
+	return (xView1.ulLength == xView2.ulLength) && (mem_cmp(xView1.pcStr, xView2.pcStr, xView1.ulLength) == 0);
+}
+
+int32_t lStrViewSrc(StrView_t xView, StrView_t xNeedle) {
+	if (xNeedle.ulLength == 0) {
+		return -1;
+	}
+	return _lStrFindFirst(xView.pcStr, xView.ulLength, xNeedle.pcStr, xNeedle.ulLength, libNULL);
+}
+
+int32_t lStrViewSrcLast(StrView_t xView, StrView_t xNeedle) {
+	if (xNeedle.ulLength == 0) {
+		return -1;
+	}
+	return _lStrFindLast(xView.pcStr, xView.ulLength, xNeedle.pcStr, xNeedle.ulLength, libNULL);
+}
+
+int32_t lStrViewSearch(const StrSearch_t *pxSearch, StrView_t xView) {
+	if (pxSearch == libNULL || pxSearch->pcNeedle == libNULL) {
+		return -1;
+	}
+	return _lStrFindFirst(xView.pcStr, xView.ulLength, pxSearch->pcNeedle, pxSearch->ulLength, pxSearch->aucShift);
+}
+
+StrView_t xStrViewTrim(StrView_t xView) {
+	while (xView.ulLength && IS_SPACE(xView.pcStr[0])) {
+		xView.pcStr++;
+		xView.ulLength--;
+	}
+	while (xView.ulLength && IS_SPACE(xView.pcStr[xView.ulLength - 1])) {
+		xView.ulLength--;
+	}
+	return xView;
+}
+
+uint8_t bStrViewSplit(StrView_t xView, char cDelimiter, StrView_t *pxHead, StrView_t *pxTail) {
+	uint32_t i = 0;
+	while (i < xView.ulLength && xView.pcStr[i] != cDelimiter) {
+		i++;
+	}
+	if (pxHead != libNULL) {
+		*pxHead = (StrView_t){ xView.pcStr, i };
+	}
+	if (pxTail != libNULL) {
+		*pxTail = (i < xView.ulLength)? (StrView_t){ xView.pcStr + i + 1, xView.ulLength - i - 1 }: (StrView_t){ xView.pcStr + i, 0 };
+	}
+	return i < xView.ulLength;
+}
+
+static inline uint8_t _bStrIsDelimiter(char c, const char *pcDelimiters) {
+	while (*pcDelimiters != '\0') {
+		if (*pcDelimiters++ == c) {
+			return 1;
 		}
-		else {
-			count = MAX_DIGITS_IN_LONG_INT;
-			char longStr[count + 1];
-			int32_t k = lValue;
-			lValue = CL_ABS(lValue);
-			longStr[count] = '\0';
-			while (lValue != 0) {
-				count--;
-				longStr[count] = '0' + lValue % 10;
-				lValue /= 10;
-			}
-			if (k < 0) {
-				count--;
-				longStr[count] = '-';
-			}
-			count = _strnCpy(pcBufer, 0, &(longStr[count]));
+	}
+	return 0;
+}
+
+uint8_t bStrViewToken(StrView_t *pxRest, const char *pcDelimiters, StrView_t *pxToken) {
+	if (pxRest == libNULL || pcDelimiters == libNULL) {
+		return 0;
+	}
+	StrView_t rest = *pxRest;
+	while (rest.ulLength && _bStrIsDelimiter(rest.pcStr[0], pcDelimiters)) {
+		rest.pcStr++;
+		rest.ulLength--;
+	}
+	if (rest.ulLength == 0) {
+		*pxRest = rest;
+		return 0;
+	}
+	uint32_t i = 1;
+	while (i < rest.ulLength && !_bStrIsDelimiter(rest.pcStr[i], pcDelimiters)) {
+		i++;
+	}
+	if (pxToken != libNULL) {
+		*pxToken = (StrView_t){ rest.pcStr, i };
+	}
+	/* Delimiter ending the token is consumed */
+	if (i < rest.ulLength) {
+		i++;
+	}
+	*pxRest = (StrView_t){ rest.pcStr + i, rest.ulLength - i };
+	return 1;
+}
+
+int32_t lStrViewCopy(char *pcBuffer, uint32_t ulSize, StrView_t xView) {
+	if (pcBuffer == libNULL || ulSize == 0) {
+		return -1;
+	}
+	uint32_t length = CL_MIN(xView.ulLength, ulSize - 1);
+	mem_cpy(pcBuffer, xView.pcStr, length);
+	pcBuffer[length] = '\0';
+	return length;
+}
+
+/* Two digits per division step */
+static const char _acStrDigitPairs[200] =
+	"00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839" "40414243444546474849"
+	"50515253545556575859" "60616263646566676869" "70717273747576777879" "80818283848586878889" "90919293949596979899";
+
+static const uint32_t _aulStrPow10[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+/* log10 estimated from bit length, corrected by one compare */
+static inline uint32_t _ulStrDecimalLength(uint32_t ulValue) {
+	ulValue |= 1;
+	uint32_t length = ((32 - __builtin_clz(ulValue)) * 1233) >> 12;
+	return length + (ulValue >= _aulStrPow10[length]);
+}
+
+/* Write exactly ulLength digits backward from pcEnd, leading zeros included */
+static inline void _vStrPutDigits(char *pcEnd, uint32_t ulValue, uint32_t ulLength) {
+	for (; ulLength >= 2; ulLength -= 2) {
+		const char *pair = &_acStrDigitPairs[(ulValue % 100) * 2];
+		ulValue /= 100;
+		*--pcEnd = pair[1];
+		*--pcEnd = pair[0];
+	}
+	if (ulLength) {
+		*--pcEnd = '0' + ulValue;
+	}
+}
+
+static uint32_t _ulStrPutUInt32(char *pcBuffer, uint32_t ulValue) {
+	uint32_t length = _ulStrDecimalLength(ulValue);
+	_vStrPutDigits(pcBuffer + length, ulValue, length);
+	pcBuffer[length] = '\0';
+	return length;
+}
+
+/* 64 bit value is split in 8 digit parts, so only two 64 bit divisions are done on 32 bit cpu */
+static uint32_t _ulStrPutUInt64(char *pcBuffer, uint64_t ullValue) {
+	if (ullValue <= 0xFFFFFFFFU) {
+		return _ulStrPutUInt32(pcBuffer, (uint32_t)ullValue);
+	}
+	uint32_t low = ullValue % 100000000;
+	ullValue /= 100000000;
+	uint32_t length;
+	if (ullValue <= 0xFFFFFFFFU) {
+		length = _ulStrPutUInt32(pcBuffer, (uint32_t)ullValue);
+	}
+	else {
+		length = _ulStrPutUInt32(pcBuffer, (uint32_t)(ullValue / 100000000));
+		_vStrPutDigits(pcBuffer + length + 8, (uint32_t)(ullValue % 100000000), 8);
+		length += 8;
+	}
+	_vStrPutDigits(pcBuffer + length + 8, low, 8);
+	length += 8;
+	pcBuffer[length] = '\0';
+	return length;
+}
+
+int32_t lLongToStr(char *pcBufer, int32_t lValue) {
+	if (pcBufer == libNULL) {
+		return -1;
+	}
+	if (lValue < 0) {
+		*pcBufer = '-';
+		return _ulStrPutUInt32(pcBufer + 1, 0U - (uint32_t)lValue) + 1;
+	}
+	return _ulStrPutUInt32(pcBufer, lValue);
+}
+
+int32_t lULongToStr(char *pcBufer, uint32_t ulValue) {
+	if (pcBufer == libNULL) {
+		return -1;
+	}
+	return _ulStrPutUInt32(pcBufer, ulValue);
+}
+
+int32_t lLongLongToStr(char *pcBufer, int64_t llValue) {
+	if (pcBufer == libNULL) {
+		return -1;
+	}
+	if (llValue < 0) {
+		*pcBufer = '-';
+		return _ulStrPutUInt64(pcBufer + 1, 0ULL - (uint64_t)llValue) + 1;
+	}
+	return _ulStrPutUInt64(pcBufer, llValue);
+}
+
+int32_t lULongLongToStr(char *pcBufer, uint64_t ullValue) {
+	if (pcBufer == libNULL) {
+		return -1;
+	}
+	return _ulStrPutUInt64(pcBufer, ullValue);
+}
+
+/* Digit value of char for bases up to 16, 0xFF if char is not a digit */
+#define _STR_DIGIT(c)           (IS_HEX(c)? CHAR_TO_HEX(c): 0xFF)
+#define _STR_DIGITS_ROW(h)      _STR_DIGIT(h + 0x0), _STR_DIGIT(h + 0x1), _STR_DIGIT(h + 0x2), _STR_DIGIT(h + 0x3), \
+                                _STR_DIGIT(h + 0x4), _STR_DIGIT(h + 0x5), _STR_DIGIT(h + 0x6), _STR_DIGIT(h + 0x7), \
+                                _STR_DIGIT(h + 0x8), _STR_DIGIT(h + 0x9), _STR_DIGIT(h + 0xA), _STR_DIGIT(h + 0xB), \
+                                _STR_DIGIT(h + 0xC), _STR_DIGIT(h + 0xD), _STR_DIGIT(h + 0xE), _STR_DIGIT(h + 0xF)
+
+static const uint8_t _aucStrDigits[256] = {
+	_STR_DIGITS_ROW(0x00), _STR_DIGITS_ROW(0x10), _STR_DIGITS_ROW(0x20), _STR_DIGITS_ROW(0x30),
+	_STR_DIGITS_ROW(0x40), _STR_DIGITS_ROW(0x50), _STR_DIGITS_ROW(0x60), _STR_DIGITS_ROW(0x70),
+	_STR_DIGITS_ROW(0x80), _STR_DIGITS_ROW(0x90), _STR_DIGITS_ROW(0xA0), _STR_DIGITS_ROW(0xB0),
+	_STR_DIGITS_ROW(0xC0), _STR_DIGITS_ROW(0xD0), _STR_DIGITS_ROW(0xE0), _STR_DIGITS_ROW(0xF0)
+};
+
+/* Parse digits of 2^ulShift notation after leading zeros into *pulValue till overflow, return pointer to
+   first char not parsed. 32 / ulShift digits can't overflow and are parsed without checks, only the next
+   one may fit or not. Loop of constant count is unrolled, so every digit gets its own exit branch */
+static inline const char *_pcStrParsePow2(uint32_t *pulValue, const char *pcStr, uint32_t ulLength, uint32_t ulShift) {
+	const char *digits = pcStr;
+	uint32_t safe = CL_MIN(ulLength, 32 / ulShift);
+	uint32_t value = 0;
+	uint32_t x;
+	if (safe == 32 / ulShift) {
+		for (uint32_t i = 0; (i < 32 / ulShift) && !((x = _aucStrDigits[(uint8_t)*pcStr]) >> ulShift); i++, pcStr++) {
+			value = (value << ulShift) | x;
+		}
+	}
+	else {
+		for (; safe && !((x = _aucStrDigits[(uint8_t)*pcStr]) >> ulShift); safe--, pcStr++) {
+			value = (value << ulShift) | x;
 		}
 	}
-	return count;
+	if (((uint32_t)(pcStr - digits) == 32 / ulShift) && (ulLength > 32 / ulShift) &&
+	    !((x = _aucStrDigits[(uint8_t)*pcStr]) >> ulShift) && (value <= (0xFFFFFFFFU >> ulShift))) {
+		value = (value << ulShift) | x;
+		pcStr++;
+	}
+	*pulValue = value;
+	return pcStr;
 }
 
-int32_t lStrToLong(uint32_t *pulValue, const char *pcStrValue, uint8_t ucBase) {
-	if ((ucBase != 2) && (ucBase != 8) && (ucBase != 10) && (ucBase != 16)) return 0; 
-	int32_t result = 0;
-	if (pcStrValue != libNULL) {
-		uint32_t Value = 0;
-		int8_t isSignedInt = 0;
-		if(ucBase == 10) {
-			if (*pcStrValue == '-' || *pcStrValue == '+') {
-				if (*pcStrValue == '-') {
-					isSignedInt = 1;
-				}
-				pcStrValue++;
-			}
+/* Parse integer from no more than ulLength chars, parsing stops before digit that overflows */
+static int32_t _lStrToLong(uint32_t *pulValue, const char *pcStrValue, uint32_t ulLength, uint8_t ucBase) {
+	uint32_t Value = 0;
+	uint32_t isSignedInt = 0;
+	const char *start;
+	if (pcStrValue == libNULL) return 0;
+	if (ucBase == 10) {
+		if (ulLength) {
+			/* Sign is skipped without branches, it's hard to predict */
+			uint32_t sign = (*pcStrValue == '-') | (*pcStrValue == '+');
+			isSignedInt = (*pcStrValue == '-');
+			pcStrValue += sign;
+			ulLength -= sign;
 		}
-		while (IS_DIGIT(*pcStrValue) || ((ucBase == 16) && IS_HEX(*pcStrValue))) {
-			uint8_t x = CHAR_TO_HEX(*pcStrValue);// IS_ALPHA(*pcStrValue)? 10 + (TO_LOWER(*pcStrValue) - 'a'): ((*pcStrValue) - '0');
-			if(x >= ucBase) break;
-			++result;
-			Value = Value * ucBase + x;
-			pcStrValue++;
+		/* Leading zeros don't change value, they are rare and skipped out of the digits path */
+		start = pcStrValue;
+		if (ulLength && (*pcStrValue == '0')) {
+			for (; ulLength && (*pcStrValue == '0'); ulLength--, pcStrValue++);
 		}
-		if (isSignedInt == 1) {
-			Value = ~(Value - 1);
+		/* Nine digits can't overflow and are parsed without checks, only the tenth may fit or not */
+		const char *digits = pcStrValue;
+		uint32_t safe = CL_MIN(ulLength, 9);
+		uint32_t x;
+		for (; safe && ((x = (uint8_t)(*pcStrValue - '0')) <= 9); safe--, pcStrValue++) {
+			Value = Value * 10 + x;
 		}
-		if(pulValue != libNULL) {
-			*pulValue = Value;
+		if ((pcStrValue - digits == 9) && (ulLength > 9) && ((x = (uint8_t)(*pcStrValue - '0')) <= 9)) {
+			uint32_t limit = 0xFFFFFFFFU - isSignedInt * 0x7FFFFFFFU;
+			if ((Value < limit / 10) || ((Value == limit / 10) && (x <= limit % 10))) {
+				Value = Value * 10 + x;
+				pcStrValue++;
+			}
 		}
+		Value = (Value ^ (0U - isSignedInt)) + isSignedInt;
 	}
-	return result;
+	else {
+		if ((ucBase != 2) && (ucBase != 8) && (ucBase != 16)) return 0;
+		start = pcStrValue;
+		if (ulLength && (*pcStrValue == '0')) {
+			for (; ulLength && (*pcStrValue == '0'); ulLength--, pcStrValue++);
+		}
+		/* Power of 2 notation, shift instead of multiplication, constant shift for each base */
+		pcStrValue = (ucBase == 16)? _pcStrParsePow2(&Value, pcStrValue, ulLength, 4):
+		             (ucBase == 8)? _pcStrParsePow2(&Value, pcStrValue, ulLength, 3):
+		                            _pcStrParsePow2(&Value, pcStrValue, ulLength, 1);
+	}
+	if (pulValue != libNULL) {
+		*pulValue = Value;
+	}
+	return pcStrValue - start;
+}
+
+int32_t lStrToLong(uint32_t *pulValue, const char *pcStrValue, uint8_t ucBase) {
+	return _lStrToLong(pulValue, pcStrValue, _STR_UNLIMITED, ucBase);
+}
+
+int32_t lStrViewToLong(uint32_t *pulValue, StrView_t xView, uint8_t ucBase) {
+	return _lStrToLong(pulValue, xView.pcStr, xView.ulLength, ucBase);
 }
 
 void vStrToLowerCase(char *pcStr) {
@@ -255,7 +739,26 @@ int32_t str_cat(char *buffer, const char *str1, const char *str2) __attribute__
 int32_t str_src(const char *str1, const char *str2) __attribute__ ((alias ("lStrSrc")));
 int32_t strn_src(const char *str1, int32_t length, const char *str2) __attribute__ ((alias ("lStrnSrc")));
 int32_t strn_src_last(const char *str1, int32_t length, const char *str2) __attribute__ ((alias ("lStrnSrcLast")));
+uint8_t str_search_init(str_search_t *search, const char *needle) __attribute__ ((alias ("bStrSearchInit")));
+int32_t str_search(const str_search_t *search, const char *str, int32_t length) __attribute__ ((alias ("lStrSearch")));
+int32_t str_search_last(const str_search_t *search, const char *str, int32_t length) __attribute__ ((alias ("lStrSearchLast")));
+int32_t strn_len(const char *str, int32_t max) __attribute__ ((alias ("lStrnLen")));
+str_view_t str_view(const char *str) __attribute__ ((alias ("xStrView")));
+int32_t str_view_cmp(str_view_t view1, str_view_t view2) __attribute__ ((alias ("lStrViewCmp")));
+int32_t str_view_case_cmp(str_view_t view1, str_view_t view2) __attribute__ ((alias ("lStrViewCaseCmp")));
+uint8_t str_view_equal(str_view_t view1, str_view_t view2) __attribute__ ((alias ("bStrViewEqual")));
+int32_t str_view_src(str_view_t view, str_view_t needle) __attribute__ ((alias ("lStrViewSrc")));
+int32_t str_view_src_last(str_view_t view, str_view_t needle) __attribute__ ((alias ("lStrViewSrcLast")));
+int32_t str_view_search(const str_search_t *search, str_view_t view) __attribute__ ((alias ("lStrViewSearch")));
+str_view_t str_view_trim(str_view_t view) __attribute__ ((alias ("xStrViewTrim")));
+uint8_t str_view_split(str_view_t view, char delimiter, str_view_t *head, str_view_t *tail) __attribute__ ((alias ("bStrViewSplit")));
+uint8_t str_view_token(str_view_t *rest, const char *delimiters, str_view_t *token) __attribute__ ((alias ("bStrViewToken")));
+int32_t str_view_to_long(uint32_t *value, str_view_t view, uint8_t base) __attribute__ ((alias ("lStrViewToLong")));
+int32_t str_view_copy(char *buffer, uint32_t size, str_view_t view) __attribute__ ((alias ("lStrViewCopy")));
 int32_t long_to_str(char *bufer, int32_t value) __attribute__ ((alias ("lLongToStr")));
+int32_t ulong_to_str(char *bufer, uint32_t value) __attribute__ ((alias ("lULongToStr")));
+int32_t long_long_to_str(char *bufer, int64_t value) __attribute__ ((alias ("lLongLongToStr")));
+int32_t ulong_long_to_str(char *bufer, uint64_t value) __attribute__ ((alias ("lULongLongToStr")));
 int32_t str_to_long(uint32_t *value, const char *str_value, uint8_t base) __attribute__ ((alias ("lStrToLong")));
 void str_to_lower_case(char *str) __attribute__ ((alias ("vStrToLowerCase")));
 void str_to_upper_case(char *str) __attribute__ ((alias ("vStrToUpperCase")));
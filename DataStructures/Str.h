@@ -17,12 +17,26 @@ extern "C" {
 #define IS_DIGIT(A)     ((A) >= '0' && (A) <= '9')
 #define IS_ALPHA(A)     (IS_UPALPHA(A) || IS_LOALPHA(A))
 #define IS_HEX(A)       (IS_DIGIT(A) || ((A) >= 'A' && (A) <= 'F') || ((A) >= 'a' && (A) <= 'f'))
+#define IS_SPACE(A)     ((A) == ' ' || ((A) >= '\t' && (A) <= '\r'))
 #define TO_LOWER(A)     ((IS_UPALPHA(A)) ? ( (A) - 'A' + 'a' ) : (A))
 #define TO_UPPER(A)     ((IS_LOALPHA(A)) ? ( (A) - 'a' + 'A' ) : (A))
 #define STR_LENGTH(A)   (sizeof(A) - 1)
 #define CHAR_TO_HEX(A)  (IS_DIGIT(A)? ((A) - '0'): ((IS_UPALPHA(A)? ((A) - 'A'):((A) - 'a')) + 10))
 #define HEX_TO_CHAR(A)  ((((A) & 0x0F)<10)? (((A) & 0x0F) + '0'): (((A) & 0x0F) - 10 + 'A'))
 
+/*!
+    String view, not terminated part of string with known length
+*/
+typedef struct {
+    const char *pcStr;
+    uint32_t ulLength;
+} StrView_t;
+
+/* Print view with printf family functions: lStreamPrintf(stream, "key=" STR_VIEW_FMT, STR_VIEW_ARG(view)) */
+#define STR_VIEW_FMT            "%.*s"
+#define STR_VIEW_ARG(xView)     (int32_t)(xView).ulLength, (xView).pcStr
+#define STR_VIEW_LITERAL(A)     ((StrView_t){ (A), STR_LENGTH(A) })
+
 /*!
     @brief Get string length
     @param[in] pcStr    String
@@ -31,6 +45,15 @@ extern "C" {
 */
 int32_t lStrLen(const char* pcStr);
 
+/*!
+    @brief Get string length, no more than lMax symbols are scanned
+    @param[in] pcStr    String
+    @param[in] lMax     Length limit
+    @return -1 in case str is NULL
+    @return Symbols count till string terminator or lMax
+*/
+int32_t lStrnLen(const char* pcStr, int32_t lMax);
+
 /*!
     @brief Compare strings case sensitive
     @param[in] pcStr1    String 1
@@ -118,20 +141,197 @@ int32_t lStrnSrc(const char* pcStr1, int32_t lLength, const char* pcStr2);
  */
 int32_t lStrnSrcLast(const char* pcStr1, int32_t lLength, const char* pcStr2);
 
+/*!
+    Precompiled needle for repeated search of the same string, fields are private
+*/
+typedef struct {
+    const char *pcNeedle;
+    uint32_t ulLength;
+    uint8_t aucShift[256];
+    uint8_t aucShiftLast[256];
+} StrSearch_t;
+
+/*!
+    @brief Prepare needle for search
+    @param[out] pxSearch  Search object
+    @param[in] pcNeedle   String to search, referenced by search object
+    @return 0 in case some of parameters is NULL or needle is empty
+    @return 1 if ok
+ */
+uint8_t bStrSearchInit(StrSearch_t *pxSearch, const char *pcNeedle);
+
+/*!
+    @brief Search first entry of needle in string with in specified length
+    @param[in] pxSearch   Search object
+    @param[in] pcStr      String
+    @param[in] lLength    String length, <0 to search whole string
+    @return -1 in case of wrong parameters or no one entry of needle in string
+    @return Offset in string to first entry of needle
+ */
+int32_t lStrSearch(const StrSearch_t *pxSearch, const char *pcStr, int32_t lLength);
+
+/*!
+    @brief Search last entry of needle in string with in specified length
+    @param[in] pxSearch   Search object
+    @param[in] pcStr      String
+    @param[in] lLength    String length, <0 to search whole string
+    @return -1 in case of wrong parameters or no one entry of needle in string
+    @return Offset in string to last entry of needle
+ */
+int32_t lStrSearchLast(const StrSearch_t *pxSearch, const char *pcStr, int32_t lLength);
+
+/*!
+    @brief Make view of string, string is measured once
+    @param[in] pcStr    String
+    @return View, empty view in case str is NULL
+ */
+StrView_t xStrView(const char *pcStr);
+
+/*!
+    @brief Make view of string part with known length
+    @param[in] pcStr     String
+    @param[in] ulLength  Length
+    @return View
+ */
+static inline StrView_t xStrViewN(const char *pcStr, uint32_t ulLength) {
+    return (StrView_t){ pcStr, ulLength };
+}
+
+/*!
+    @brief Compare views case sensitive, as unsigned bytes
+    @param[in] xView1    View 1
+    @param[in] xView2    View 2
+    @return 0 in case views are equal, <0 if view 1 is less, >0 if view 1 is greater
+ */
+int32_t lStrViewCmp(StrView_t xView1, StrView_t xView2);
+
+/*!
+    @brief Compare views case not sensitive
+    @param[in] xView1    View 1
+    @param[in] xView2    View 2
+    @return 0 in case views are equal, <0 if view 1 is less, >0 if view 1 is greater
+ */
+int32_t lStrViewCaseCmp(StrView_t xView1, StrView_t xView2);
+
+/*!
+    @brief Check views contents are equal
+    @param[in] xView1    View 1
+    @param[in] xView2    View 2
+    @return 1 in case views are equal, 0 in other case
+ */
+uint8_t bStrViewEqual(StrView_t xView1, StrView_t xView2);
+
+/*!
+    @brief Search first entry of needle in view
+    @param[in] xView     View
+    @param[in] xNeedle   Needle
+    @return -1 in case needle is empty or no one entry of needle in view
+    @return Offset in view to first entry of needle
+ */
+int32_t lStrViewSrc(StrView_t xView, StrView_t xNeedle);
+
+/*!
+    @brief Search last entry of needle in view
+    @param[in] xView     View
+    @param[in] xNeedle   Needle
+    @return -1 in case needle is empty or no one entry of needle in view
+    @return Offset in view to last entry of needle
+ */
+int32_t lStrViewSrcLast(StrView_t xView, StrView_t xNeedle);
+
+/*!
+    @brief Search first entry of precompiled needle in view
+    @param[in] pxSearch  Search object
+    @param[in] xView     View
+    @return -1 in case of wrong parameters or no one entry of needle in view
+    @return Offset in view to first entry of needle
+ */
+int32_t lStrViewSearch(const StrSearch_t *pxSearch, StrView_t xView);
+
+/*!
+    @brief Remove leading and trailing white spaces
+    @param[in] xView     View
+    @return Trimmed view
+ */
+StrView_t xStrViewTrim(StrView_t xView);
+
+/*!
+    @brief Split view at first delimiter, delimiter is not included to parts
+    @param[in] xView       View
+    @param[in] cDelimiter  Delimiter
+    @param[out] pxHead     Part before delimiter, whole view if no delimiter, optional
+    @param[out] pxTail     Part after delimiter, empty if no delimiter, optional
+    @return 1 in case delimiter is found, 0 in other case
+ */
+uint8_t bStrViewSplit(StrView_t xView, char cDelimiter, StrView_t *pxHead, StrView_t *pxTail);
+
+/*!
+    @brief Get next token, leading delimiters are skipped
+    @param[in/out] pxRest      View to tokenize, moved past the token and its delimiter
+    @param[in] pcDelimiters    Delimiters set
+    @param[out] pxToken        Token, optional
+    @return 1 in case token found, 0 if no more tokens
+ */
+uint8_t bStrViewToken(StrView_t *pxRest, const char *pcDelimiters, StrView_t *pxToken);
+
+/*!
+    @brief Parse view representation of an integer in to value, same as lStrToLong
+    @param[out] pulValue   Integer buffer
+    @param[in] xView       Integer string view
+    @param[in] ucBase      Notation (2,8,10,16)
+    @return Characters parced
+ */
+int32_t lStrViewToLong(uint32_t *pulValue, StrView_t xView, uint8_t ucBase);
+
+/*!
+    @brief Copy view into user buffer as terminated string
+    @param[out] pcBuffer   User buffer
+    @param[in] ulSize      Buffer size
+    @param[in] xView       View
+    @return -1 in case buffer is NULL or size is 0
+    @return Symbols copied, view is truncated to fit buffer
+ */
+int32_t lStrViewCopy(char *pcBuffer, uint32_t ulSize, StrView_t xView);
+
 /*!
     @brief Places string representation of an integer value in the buffer
-    @param[in] pcBufer   User buffer
+    @param[in] pcBufer   User buffer, 12 bytes is enough for any value
     @param[in] lValue    Integer value
     @return Characters count, -1 in case of error
  */
 int32_t lLongToStr(char* pcBufer, int32_t lValue);
 
+/*!
+    @brief Places string representation of an unsigned integer value in the buffer
+    @param[in] pcBufer   User buffer, 11 bytes is enough for any value
+    @param[in] ulValue   Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t lULongToStr(char* pcBufer, uint32_t ulValue);
+
+/*!
+    @brief Places string representation of a 64 bit integer value in the buffer
+    @param[in] pcBufer   User buffer, 21 bytes is enough for any value
+    @param[in] llValue   Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t lLongLongToStr(char* pcBufer, int64_t llValue);
+
+/*!
+    @brief Places string representation of a 64 bit unsigned integer value in the buffer
+    @param[in] pcBufer   User buffer, 21 bytes is enough for any value
+    @param[in] ullValue  Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t lULongLongToStr(char* pcBufer, uint64_t ullValue);
+
 /*!
     @brief Parse string representation of an integer in to value
     @param[out] plOutValue Integer buffer
     @param[in] pcStrValue  Integer string
     @param[in] ucBase      Notation (2,8,10,16)
-    @return Characters parced
+    @return Characters parced, parsing stops before digit that overflows 32 bit value
+            (-2147483648 for negative numbers)
  */
 int32_t lStrToLong(uint32_t *plOutValue, const char *pcStrValue, uint8_t ucBase);
 
@@ -246,20 +446,200 @@ int32_t strn_src(const char *str1, int32_t length, const char *str2);
  */
 int32_t strn_src_last(const char *str1, int32_t length, const char *str2);
 
+typedef StrSearch_t str_search_t;
+
+/*!
+    @brief Prepare needle for search
+    @param[out] search  Search object
+    @param[in] needle   String to search, referenced by search object
+    @return 0 in case some of parameters is NULL or needle is empty
+    @return 1 if ok
+ */
+uint8_t str_search_init(str_search_t *search, const char *needle);
+
+/*!
+    @brief Search first entry of needle in string with in specified length
+    @param[in] search   Search object
+    @param[in] str      String
+    @param[in] length   String length, <0 to search whole string
+    @return -1 in case of wrong parameters or no one entry of needle in string
+    @return Offset in string to first entry of needle
+ */
+int32_t str_search(const str_search_t *search, const char *str, int32_t length);
+
+/*!
+    @brief Search last entry of needle in string with in specified length
+    @param[in] search   Search object
+    @param[in] str      String
+    @param[in] length   String length, <0 to search whole string
+    @return -1 in case of wrong parameters or no one entry of needle in string
+    @return Offset in string to last entry of needle
+ */
+int32_t str_search_last(const str_search_t *search, const char *str, int32_t length);
+
+typedef StrView_t str_view_t;
+
+/*!
+    @brief Get string length, no more than max symbols are scanned
+    @param[in] str    String
+    @param[in] max    Length limit
+    @return -1 in case str is NULL
+    @return Symbols count till string terminator or max
+*/
+int32_t strn_len(const char *str, int32_t max);
+
+/*!
+    @brief Make view of string, string is measured once
+    @param[in] str    String
+    @return View, empty view in case str is NULL
+ */
+str_view_t str_view(const char *str);
+
+/*!
+    @brief Make view of string part with known length
+    @param[in] str     String
+    @param[in] length  Length
+    @return View
+ */
+static inline str_view_t str_view_n(const char *str, uint32_t length) {
+    return xStrViewN(str, length);
+}
+
+/*!
+    @brief Compare views case sensitive, as unsigned bytes
+    @param[in] view1    View 1
+    @param[in] view2    View 2
+    @return 0 in case views are equal, <0 if view 1 is less, >0 if view 1 is greater
+ */
+int32_t str_view_cmp(str_view_t view1, str_view_t view2);
+
+/*!
+    @brief Compare views case not sensitive
+    @param[in] view1    View 1
+    @param[in] view2    View 2
+    @return 0 in case views are equal, <0 if view 1 is less, >0 if view 1 is greater
+ */
+int32_t str_view_case_cmp(str_view_t view1, str_view_t view2);
+
+/*!
+    @brief Check views contents are equal
+    @param[in] view1    View 1
+    @param[in] view2    View 2
+    @return 1 in case views are equal, 0 in other case
+ */
+uint8_t str_view_equal(str_view_t view1, str_view_t view2);
+
+/*!
+    @brief Search first entry of needle in view
+    @param[in] view     View
+    @param[in] needle   Needle
+    @return -1 in case needle is empty or no one entry of needle in view
+    @return Offset in view to first entry of needle
+ */
+int32_t str_view_src(str_view_t view, str_view_t needle);
+
+/*!
+    @brief Search last entry of needle in view
+    @param[in] view     View
+    @param[in] needle   Needle
+    @return -1 in case needle is empty or no one entry of needle in view
+    @return Offset in view to last entry of needle
+ */
+int32_t str_view_src_last(str_view_t view, str_view_t needle);
+
+/*!
+    @brief Search first entry of precompiled needle in view
+    @param[in] search   Search object
+    @param[in] view     View
+    @return -1 in case of wrong parameters or no one entry of needle in view
+    @return Offset in view to first entry of needle
+ */
+int32_t str_view_search(const str_search_t *search, str_view_t view);
+
+/*!
+    @brief Remove leading and trailing white spaces
+    @param[in] view     View
+    @return Trimmed view
+ */
+str_view_t str_view_trim(str_view_t view);
+
+/*!
+    @brief Split view at first delimiter, delimiter is not included to parts
+    @param[in] view        View
+    @param[in] delimiter   Delimiter
+    @param[out] head       Part before delimiter, whole view if no delimiter, optional
+    @param[out] tail       Part after delimiter, empty if no delimiter, optional
+    @return 1 in case delimiter is found, 0 in other case
+ */
+uint8_t str_view_split(str_view_t view, char delimiter, str_view_t *head, str_view_t *tail);
+
+/*!
+    @brief Get next token, leading delimiters are skipped
+    @param[in/out] rest      View to tokenize, moved past the token and its delimiter
+    @param[in] delimiters    Delimiters set
+    @param[out] token        Token, optional
+    @return 1 in case token found, 0 if no more tokens
+ */
+uint8_t str_view_token(str_view_t *rest, const char *delimiters, str_view_t *token);
+
+/*!
+    @brief Parse view representation of an integer in to value, same as str_to_long
+    @param[out] value   Integer buffer
+    @param[in] view     Integer string view
+    @param[in] base     Notation (2,8,10,16)
+    @return Characters parced
+ */
+int32_t str_view_to_long(uint32_t *value, str_view_t view, uint8_t base);
+
+/*!
+    @brief Copy view into user buffer as terminated string
+    @param[out] buffer   User buffer
+    @param[in] size      Buffer size
+    @param[in] view      View
+    @return -1 in case buffer is NULL or size is 0
+    @return Symbols copied, view is truncated to fit buffer
+ */
+int32_t str_view_copy(char *buffer, uint32_t size, str_view_t view);
+
 /*!
     @brief Places string representation of an integer value in the buffer
-    @param[in] bufer   User buffer
+    @param[in] bufer   User buffer, 12 bytes is enough for any value
     @param[in] value    Integer value
     @return Characters count, -1 in case of error
  */
 int32_t long_to_str(char *bufer, int32_t value);
 
+/*!
+    @brief Places string representation of an unsigned integer value in the buffer
+    @param[in] bufer   User buffer, 11 bytes is enough for any value
+    @param[in] value   Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t ulong_to_str(char *bufer, uint32_t value);
+
+/*!
+    @brief Places string representation of a 64 bit integer value in the buffer
+    @param[in] bufer   User buffer, 21 bytes is enough for any value
+    @param[in] value   Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t long_long_to_str(char *bufer, int64_t value);
+
+/*!
+    @brief Places string representation of a 64 bit unsigned integer value in the buffer
+    @param[in] bufer   User buffer, 21 bytes is enough for any value
+    @param[in] value   Integer value
+    @return Characters count, -1 in case of error
+ */
+int32_t ulong_long_to_str(char *bufer, uint64_t value);
+
 /*!
     @brief Parse string representation of an integer in to value
     @param[out] value    Integer buffer
     @param[in] str_value Integer string
     @param[in] base      
-    @return Characters parced
+    @return Characters parced, parsing stops before digit that overflows 32 bit value
+            (-2147483648 for negative numbers)
  */
 int32_t str_to_long(uint32_t *value, const char *str_value, uint8_t base);
 
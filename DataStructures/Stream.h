@@ -103,6 +103,34 @@ static inline int32_t lStreamReadAvailable(Stream_t *pxStream) {
 	return lFifoAvailableToRead(pxStream->pxIFifo);
 }
 
+#ifdef CL_FIFO_WAIT
+
+/*!
+	@brief Block calling thread till data available in input fifo, Linux only
+	@param[in]pxStream	Stream descriptor
+	@param[in]uCount	Data count to wait for
+	@param[in]ulTimeout	Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout
+	@return Bytes count available to read, less than uCount on timeout, <0 if error
+*/
+static inline int32_t lStreamWaitReadable(Stream_t *pxStream, BufferSize_t uCount, uint32_t ulTimeout) {
+    if(pxStream == libNULL) return STREAM_FAIL;
+	return lFifoWaitReadable(pxStream->pxIFifo, uCount, ulTimeout);
+}
+
+/*!
+	@brief Block calling thread till free space available in output fifo, Linux only
+	@param[in]pxStream	Stream descriptor
+	@param[in]uCount	Free space to wait for
+	@param[in]ulTimeout	Timeout in ms, FIFO_WAIT_FOREVER to wait without timeout
+	@return Bytes count available to write, less than uCount on timeout, <0 if error
+*/
+static inline int32_t lStreamWaitWritable(Stream_t *pxStream, BufferSize_t uCount, uint32_t ulTimeout) {
+    if(pxStream == libNULL) return STREAM_FAIL;
+	return lFifoWaitWritable(pxStream->pxOFifo, uCount, ulTimeout);
+}
+
+#endif
+
 /*!
 	@brief Get data from stream buffer
 	@param[in]pxStream	Stream descriptor
@@ -202,6 +230,10 @@ static inline int32_t stream_write_all(stream_t *, const uint8_t *, uint32_t) __
 static inline int32_t stream_write_string(stream_t *, const char *) __attribute__ ((alias ("lStreamWriteString")));
 static inline int32_t stream_write_available(stream_t *) __attribute__ ((alias ("lStreamWriteAvailable")));
 static inline int32_t stream_read_available(stream_t *) __attribute__ ((alias ("lStreamReadAvailable")));
+#ifdef CL_FIFO_WAIT
+static inline int32_t stream_wait_readable(stream_t *, buffer_size_t, uint32_t) __attribute__ ((alias ("lStreamWaitReadable")));
+static inline int32_t stream_wait_writable(stream_t *, buffer_size_t, uint32_t) __attribute__ ((alias ("lStreamWaitWritable")));
+#endif
 static inline int32_t stream_read(stream_t *, uint8_t *, uint32_t) __attribute__ ((alias ("lStreamRead")));
 static inline int32_t stream_shift(stream_t *, uint32_t) __attribute__ ((alias ("lStreamShift")));
 static inline int32_t stream_peek(stream_t *, uint8_t *, uint32_t) __attribute__ ((alias ("lStreamPeek")));
@@ -14,7 +14,7 @@ extern "C" {
 #endif
 
 #define MODBUS_ERROR_FLAG                   0x80
-#define MODBUS_DESCRIPTOR_SIZE              56
+#define MODBUS_DESCRIPTOR_SIZE              (7 * sizeof(void *) + 28)
 
 typedef struct {
 	CL_PRIVATE(MODBUS_DESCRIPTOR_SIZE);
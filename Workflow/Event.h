@@ -1,8 +1,8 @@
 #ifndef CL_EVENT_H_
 #define CL_EVENT_H_
 
-#define CL_DELEGATE_PRIVATE_SIZE    16
-#define CL_EVENT_PRIVATE_SIZE        4
+#define CL_DELEGATE_PRIVATE_SIZE    (3 * sizeof(void *) + 4)
+#define CL_EVENT_PRIVATE_SIZE        sizeof(void *)
 
 typedef void (*event_handler_t)(void *event_trigger, void *sender, void *context);
 
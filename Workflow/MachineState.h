@@ -43,9 +43,9 @@ extern "C" {
 #endif
 
 #ifdef DEBUG
-  #define CL_FSM_PRIVATE_SIZE   16
+  #define CL_FSM_PRIVATE_SIZE   (4 * sizeof(void *))
 #else
-  #define CL_FSM_PRIVATE_SIZE   12
+  #define CL_FSM_PRIVATE_SIZE   (3 * sizeof(void *))
 #endif
 
 typedef uint32_t FsmEvent_t;
@@ -0,0 +1,127 @@
+/*!
+    Base64Bench.c
+
+    lBase64Encode and lBase64Decode compared with sextet per iteration
+    loops they replaced, for 64 B to 1 MiB of binary data. Outputs of
+    both are checked to match.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "ClBench.h"
+
+#define B64_BENCH_MAX     (1024 * 1024)
+
+/* Sextet per iteration reference: encoder and decoder as they were before SIMD kernels */
+static const uint8_t aucB64RefEncode[64] = {
+	'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P',
+	'Q','R','S','T','U','V','W','X','Y','Z','a','b','c','d','e','f',
+	'g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v',
+	'w','x','y','z','0','1','2','3','4','5','6','7','8','9','+','/'
+};
+static const uint8_t aucB64RefDecode[80] = {
+	                                            62, 0xFF, 0xFF, 0xFF, 63,
+	52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 0xFF, 0xFF, 0xFF, 0, 0xFF, 0xFF,
+	0xFF, 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+	15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+	41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51
+};
+static const uint8_t aucB64RefEncShift[4] = {2, 4, 6, 8};
+static const uint8_t aucB64RefDataShift[4] = {8, 4, 2, 0};
+
+static int32_t __attribute__((noinline)) lB64RefEncode(uint8_t *pucOut, const uint8_t *pucData, uint32_t ulLength) {
+	int32_t bufIndex = 0;
+	uint8_t left = 0;
+	for (uint32_t i = 0; i < ulLength; i++) {
+		uint8_t encode = left | pucData[i] >> aucB64RefEncShift[bufIndex & 3];
+		pucOut[bufIndex] = aucB64RefEncode[encode & 0x3f];
+		bufIndex++;
+		left = pucData[i] << aucB64RefDataShift[bufIndex & 3];
+		if ((bufIndex & 3) == 3) i--;
+	}
+	if (bufIndex & 3) pucOut[bufIndex++] = aucB64RefEncode[left & 0x3f];
+	if (bufIndex & 3) pucOut[bufIndex++] = '=';
+	if (bufIndex & 3) pucOut[bufIndex++] = '=';
+	return bufIndex;
+}
+
+static int32_t __attribute__((noinline)) lB64RefDecode(uint8_t *pucOut, const uint8_t *pucBase64, uint32_t ulLength) {
+	int32_t bufIndex = 0;
+	uint8_t left = 0;
+	for (uint32_t i = 0; i < ulLength; i++) {
+		uint8_t sextet = pucBase64[i];
+		if (((i & 3) >= 2) && (sextet == '=')) break;
+		if ((sextet < 43) || (sextet > 122) || ((sextet = aucB64RefDecode[sextet - 43]) >= 64)) return -1;
+		pucOut[bufIndex] = left;
+		pucOut[bufIndex] |= sextet >> aucB64RefDataShift[i & 3];
+		left = sextet << aucB64RefEncShift[i & 3];
+		if (i & 3) bufIndex++;
+	}
+	return bufIndex;
+}
+
+typedef struct {
+	uint8_t *data;
+	uint8_t *text;
+	uint8_t *out;
+	uint32_t length;
+	uint32_t textLength;
+} B64BenchArg_t;
+
+static void vB64BenchEncode(void *pvArg) {
+	B64BenchArg_t *arg = (B64BenchArg_t *)pvArg;
+	ulClBenchSink += lBase64Encode(arg->out, 2 * B64_BENCH_MAX, arg->data, arg->length);
+}
+
+static void vB64BenchRefEncode(void *pvArg) {
+	B64BenchArg_t *arg = (B64BenchArg_t *)pvArg;
+	ulClBenchSink += lB64RefEncode(arg->out, arg->data, arg->length);
+}
+
+static void vB64BenchDecode(void *pvArg) {
+	B64BenchArg_t *arg = (B64BenchArg_t *)pvArg;
+	ulClBenchSink += lBase64Decode(arg->out, 2 * B64_BENCH_MAX, arg->text, arg->textLength);
+}
+
+static void vB64BenchRefDecode(void *pvArg) {
+	B64BenchArg_t *arg = (B64BenchArg_t *)pvArg;
+	ulClBenchSink += lB64RefDecode(arg->out, arg->text, arg->textLength);
+}
+
+int main(void) {
+	B64BenchArg_t arg = {
+		.data = malloc(B64_BENCH_MAX), .text = malloc(2 * B64_BENCH_MAX), .out = malloc(2 * B64_BENCH_MAX)
+	};
+	uint8_t *check = malloc(2 * B64_BENCH_MAX);
+	if ((arg.data == libNULL) || (arg.text == libNULL) || (arg.out == libNULL) || (check == libNULL)) {
+		return 1;
+	}
+	for (uint32_t i = 0; i < B64_BENCH_MAX; i++) {
+		arg.data[i] = (uint8_t)(i * 2654435761UL >> 24);
+	}
+	int res = 0;
+	printf("%8s %8s %14s %14s %8s\n", "op", "bytes", "old MB/s", "new MB/s", "speedup");
+	for (uint32_t op = 0; op < 2; op++) {
+		/* Odd lengths, padding and scalar tails are included */
+		for (uint32_t length = 64; length <= B64_BENCH_MAX; length *= 4) {
+			arg.length = length + 1;
+			arg.textLength = (uint32_t)lB64RefEncode(arg.text, arg.data, arg.length);
+			int32_t refLen = op? lB64RefDecode(check, arg.text, arg.textLength): (int32_t)arg.textLength;
+			int32_t newLen = op? lBase64Decode(arg.out, 2 * B64_BENCH_MAX, arg.text, arg.textLength):
+			                     lBase64Encode(arg.out, 2 * B64_BENCH_MAX, arg.data, arg.length);
+			const uint8_t *ref = op? check: arg.text;
+			uint8_t mismatch = (refLen != newLen) || (memcmp(ref, arg.out, (size_t)refLen) != 0);
+			double old = dClBenchNsPerCall(op? vB64BenchRefDecode: vB64BenchRefEncode, &arg);
+			double new = dClBenchNsPerCall(op? vB64BenchDecode: vB64BenchEncode, &arg);
+			printf("%8s %8u %14.1f %14.1f %7.2fx%s\n", op? "decode": "encode", arg.length,
+				dClBenchMbps(old, arg.length), dClBenchMbps(new, arg.length), old / new,
+				mismatch? "  MISMATCH": "");
+			res |= mismatch;
+		}
+	}
+	free(check);
+	free(arg.out);
+	free(arg.text);
+	free(arg.data);
+	return res;
+}
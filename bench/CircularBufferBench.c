@@ -0,0 +1,126 @@
+/*!
+    CircularBufferBench.c
+
+    Write then read transfer through CircularBuffer compared with
+    byte per iteration loop it replaced, for 1 B, 64 B and 4 KiB transfers.
+*/
+#include <string.h>
+#include "ClBench.h"
+
+#define CB_BENCH_STORAGE  (16 * 1024 + 64)
+
+/* Byte per iteration reference: CircularBuffer read and write as they were before segment copies */
+typedef struct {
+	uint16_t tail;
+	uint16_t head;
+	uint16_t tailBackup;
+	uint16_t headBackup;
+	uint16_t size;
+	uint16_t validation;
+	uint8_t buffer[CB_BENCH_STORAGE];
+} ByteRing_t;
+
+static ByteRing_t *__attribute__((noinline)) pxByteRingCast(void *pvDescriptor) {
+	ByteRing_t *desc = (ByteRing_t *)pvDescriptor;
+	return ((desc == libNULL) || (desc->validation != 0xCCB5))? libNULL: desc;
+}
+
+static int32_t __attribute__((noinline)) lByteRingAvailable(void *pvDescriptor) {
+	ByteRing_t *desc = pxByteRingCast(pvDescriptor);
+	int32_t av = -1;
+	if (desc != libNULL) {
+		if (desc->head == 0xFFFF) av = desc->size;
+		else av = ((desc->head >= desc->tail)? (desc->head - desc->tail): ((desc->size - desc->tail) + desc->head));
+	}
+	return av;
+}
+
+static int32_t __attribute__((noinline)) lByteRingWrite(void *pvDescriptor, const uint8_t *pucData, uint16_t uCount) {
+	ByteRing_t *desc = pxByteRingCast(pvDescriptor);
+	if (desc == libNULL || pucData == libNULL) {
+		return -1;
+	}
+	int32_t res = 0;
+	if (uCount != 0) {
+		uint16_t tail = desc->tail;
+		uint16_t head = desc->head;
+		if (desc->tailBackup != 0xFFFF) {
+			tail = desc->tailBackup;
+		}
+		while ((res != uCount) && (head != 0xFFFF)) {
+			desc->buffer[head++] = *pucData++;
+			res++;
+			if (head >= desc->size) head = 0;
+			if (head == tail) head = 0xFFFF;
+		}
+		desc->head = head;
+	}
+	return res;
+}
+
+static int32_t __attribute__((noinline)) lByteRingRead(void *pvDescriptor, uint8_t *pucOutBuf, uint16_t uCount) {
+	ByteRing_t *desc = pxByteRingCast(pvDescriptor);
+	if (desc == libNULL || pucOutBuf == libNULL) {
+		return -1;
+	}
+	int32_t res = 0;
+	int32_t dataCount = lByteRingAvailable(pvDescriptor);
+	if (uCount && dataCount) {
+		uint16_t tail = desc->tail;
+		uint16_t head = desc->head;
+		if (head == 0xFFFF) head = tail;
+		do {
+			*pucOutBuf++ = desc->buffer[tail++];
+			if (tail >= desc->size) tail = 0;
+			res++;
+		} while (res != uCount && tail != head);
+		desc->tail = tail;
+		desc->head = head;
+	}
+	return res;
+}
+
+typedef struct {
+	CircularBuffer_t *cb;
+	ByteRing_t *ring;
+	uint16_t count;
+	uint8_t *in;
+	uint8_t *out;
+} CbBenchArg_t;
+
+static void vCbBenchNew(void *pvArg) {
+	CbBenchArg_t *arg = (CbBenchArg_t *)pvArg;
+	ulClBenchSink += lCircularBufferWrite(arg->cb, arg->in, arg->count, 0, 0, 0);
+	ulClBenchSink += lCircularBufferRead(arg->cb, arg->out, arg->count, 0, 0);
+}
+
+static void vCbBenchOld(void *pvArg) {
+	CbBenchArg_t *arg = (CbBenchArg_t *)pvArg;
+	ulClBenchSink += lByteRingWrite(arg->ring, arg->in, arg->count);
+	ulClBenchSink += lByteRingRead(arg->ring, arg->out, arg->count);
+}
+
+int main(void) {
+	static uint8_t storage[CB_BENCH_STORAGE];
+	static ByteRing_t ring;
+	static uint8_t in[4096], out[4096];
+	static const uint16_t counts[] = {1, 64, 4096};
+	CbBenchArg_t arg = { .ring = &ring, .in = in, .out = out };
+	/* Odd data space, transfers wrap at varying offsets */
+	arg.cb = pxCircularBufferInit(storage, sizeof(storage) - 13);
+	ring.size = (uint16_t)lCircularBufferFree(arg.cb);
+	ring.tailBackup = ring.headBackup = 0xFFFF;
+	ring.validation = 0xCCB5;
+	for (uint32_t i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)i;
+	}
+	printf("%8s %14s %14s %8s\n", "bytes", "old MB/s", "new MB/s", "speedup");
+	for (uint32_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+		arg.count = counts[i];
+		double old = dClBenchNsPerCall(vCbBenchOld, &arg);
+		double new = dClBenchNsPerCall(vCbBenchNew, &arg);
+		printf("%8u %14.1f %14.1f %7.2fx\n", counts[i], dClBenchMbps(old, 2 * counts[i]),
+			dClBenchMbps(new, 2 * counts[i]), old / new);
+	}
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*!
+    ClBench.h
+
+    Minimal host benchmark helpers. Timings are best of several rounds,
+    each round is repeated until it lasts long enough for the clock.
+*/
+#ifndef CL_BENCH_H_INCLUDED
+#define CL_BENCH_H_INCLUDED
+
+#include <stdio.h>
+#include <time.h>
+#include "CodeLib.h"
+
+#define CL_BENCH_ROUNDS       5
+#define CL_BENCH_ROUND_NS     20000000ULL
+
+typedef void (*ClBenchRun_t)(void *pvArg);
+
+/* Results are summed here, so compiler can't drop benchmarked work */
+static volatile uint32_t ulClBenchSink;
+
+static inline uint64_t ullClBenchNowNs(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/*!
+	@brief Measure run function
+	@param[in] pfRun    Benchmarked function
+	@param[in] pvArg    Function argument
+	@return Nanoseconds per call, best of rounds
+*/
+static inline double dClBenchNsPerCall(ClBenchRun_t pfRun, void *pvArg) {
+	uint64_t calls = 1;
+	double best = 0;
+	for (uint32_t round = 0; round < CL_BENCH_ROUNDS; round++) {
+		uint64_t elapsed;
+		do {
+			uint64_t start = ullClBenchNowNs();
+			for (uint64_t i = 0; i < calls; i++) {
+				pfRun(pvArg);
+			}
+			elapsed = ullClBenchNowNs() - start;
+			if (elapsed < CL_BENCH_ROUND_NS) {
+				calls *= 2;
+			}
+		} while (elapsed < CL_BENCH_ROUND_NS / 2);
+		double ns = (double)elapsed / calls;
+		if ((round == 0) || (ns < best)) {
+			best = ns;
+		}
+	}
+	return best;
+}
+
+/* MB/s for given bytes per call */
+static inline double dClBenchMbps(double dNsPerCall, uint64_t ullBytes) {
+	return (dNsPerCall > 0)? (ullBytes * 1000.0 / dNsPerCall): 0;
+}
+
+#endif /* CL_BENCH_H_INCLUDED */
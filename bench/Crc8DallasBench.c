@@ -0,0 +1,135 @@
+/*!
+    Crc8DallasBench.c
+
+    CRC8 Dallas throughput for 1-Wire sized buffers (8 to 64 bytes) and a
+    bulk 64 KiB buffer: former _ucCrc8DallasNext loop, 256 entry table and
+    slicing-by-4 loops, then ucCrc8Dallas of this build. Configure with
+    -DCL_CRC8_SLICING_BY_4=ON to get the slicing-by-4 library row. Every
+    result is checked against the former loop.
+*/
+#include "ClBench.h"
+
+#define CRC8_BENCH_BULK         (64 * 1024)
+
+#ifdef CL_CRC8_SLICING_BY_4
+#define CRC8_BENCH_VARIANT      "slicing-by-4"
+#else
+#define CRC8_BENCH_VARIANT      "table"
+#endif
+
+/* Former byte step, nibbles of result are swapped */
+static uint8_t _ucCrc8BenchNext(uint8_t ucData) {
+	const uint8_t pucCrcBitComp[] = { 0x5e, 0xbc, 0x61, 0xc2, 0x9d, 0x23, 0x46, 0x8c };
+	uint8_t crc = 0;
+	uint8_t i;
+	for (i = 0; i < 8; i++) {
+		crc ^= (ucData & (0x01 << i)) ? pucCrcBitComp[i] : 0;
+	}
+	return ((crc<<4)|(crc>>4));
+}
+
+static uint8_t __attribute__((noinline)) ucCrc8BenchFormer(const uint8_t *pucData, uint32_t ulLen) {
+	uint8_t crc = 0;
+	for (uint32_t i = 0; i < ulLen; ++i) {
+		crc = _ucCrc8BenchNext(pucData[i] ^ crc);
+	}
+	return crc;
+}
+
+/* Same loops as Crc.c, tables built from the former byte step */
+static uint8_t aucCrc8BenchTable[4][256];
+
+static uint8_t __attribute__((noinline)) ucCrc8BenchTable(const uint8_t *pucData, uint32_t ulLen) {
+	uint8_t crc = 0;
+	while (ulLen--) {
+		crc = aucCrc8BenchTable[0][crc ^ *pucData++];
+	}
+	return crc;
+}
+
+static uint8_t __attribute__((noinline)) ucCrc8BenchSlicing(const uint8_t *pucData, uint32_t ulLen) {
+	uint8_t crc = 0;
+	for (; ulLen >= 4; ulLen -= 4, pucData += 4) {
+		crc = aucCrc8BenchTable[3][crc ^ pucData[0]] ^ aucCrc8BenchTable[2][pucData[1]] ^
+		      aucCrc8BenchTable[1][pucData[2]] ^ aucCrc8BenchTable[0][pucData[3]];
+	}
+	while (ulLen--) {
+		crc = aucCrc8BenchTable[0][crc ^ *pucData++];
+	}
+	return crc;
+}
+
+static uint8_t ucCrc8BenchLibrary(const uint8_t *pucData, uint32_t ulLen) {
+	return ucCrc8Dallas(pucData, ulLen, libNULL);
+}
+
+static void vCrc8BenchTableInit(void) {
+	for (uint32_t i = 0; i < 256; i++) {
+		aucCrc8BenchTable[0][i] = _ucCrc8BenchNext((uint8_t)i);
+	}
+	/* Byte step is linear, so k more zero bytes is k more table lookups */
+	for (uint32_t k = 1; k < 4; k++) {
+		for (uint32_t i = 0; i < 256; i++) {
+			aucCrc8BenchTable[k][i] = aucCrc8BenchTable[0][aucCrc8BenchTable[k - 1][i]];
+		}
+	}
+}
+
+typedef struct {
+	uint8_t (*pfCrc)(const uint8_t *pucData, uint32_t ulLen);
+	const uint8_t *data;
+	uint32_t len;
+	uint8_t crc;
+} Crc8BenchArg_t;
+
+static void vCrc8BenchRun(void *pvArg) {
+	Crc8BenchArg_t *arg = (Crc8BenchArg_t *)pvArg;
+	arg->crc = arg->pfCrc(arg->data, arg->len);
+	ulClBenchSink += arg->crc;
+}
+
+int main(void) {
+	static uint8_t data[CRC8_BENCH_BULK];
+	static const uint32_t sizes[] = {8, 16, 32, 64, CRC8_BENCH_BULK};
+	static const struct {
+		const char *name;
+		uint8_t (*pfCrc)(const uint8_t *pucData, uint32_t ulLen);
+	} rows[] = {
+		{"former",                       ucCrc8BenchFormer},
+		{"table",                        ucCrc8BenchTable},
+		{"slicing-by-4",                 ucCrc8BenchSlicing},
+		{"lib " CRC8_BENCH_VARIANT,      ucCrc8BenchLibrary},
+	};
+	int res = 0;
+	vCrc8BenchTableInit();
+	for (uint32_t i = 0; i < CRC8_BENCH_BULK; i++) {
+		data[i] = (uint8_t)(i * 2654435761UL >> 24);
+	}
+	/* Every length up to 64 bytes at unaligned starts */
+	for (uint32_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+		for (uint32_t offset = 0; offset < 4; offset++) {
+			for (uint32_t len = 0; len <= 64; len++) {
+				if (rows[r].pfCrc(&data[offset], len) != ucCrc8BenchFormer(&data[offset], len)) {
+					printf("%s: MISMATCH at offset %u length %u\n", rows[r].name, offset, len);
+					res = 1;
+				}
+			}
+		}
+	}
+	printf("library built with %s\n", CRC8_BENCH_VARIANT);
+	printf("%-20s %8s %8s %8s %8s %8s   MB/s\n", "crc8 dallas", "8 B", "16 B", "32 B", "64 B", "64 KiB");
+	for (uint32_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+		Crc8BenchArg_t arg = { .pfCrc = rows[r].pfCrc, .data = data };
+		uint8_t mismatch = 0;
+		printf("%-20s", rows[r].name);
+		for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+			arg.len = sizes[s];
+			double ns = dClBenchNsPerCall(vCrc8BenchRun, &arg);
+			mismatch |= (arg.crc != ucCrc8BenchFormer(data, arg.len));
+			printf(" %8.1f", dClBenchMbps(ns, arg.len));
+		}
+		printf("%s\n", mismatch? "  MISMATCH": "");
+		res |= mismatch;
+	}
+	return res;
+}
@@ -0,0 +1,154 @@
+/*!
+    CrcBench.c
+
+    CRC-32 backends throughput for 4 KiB to 1 MiB buffers: former bitwise
+    engine, nibble and slicing-by-8 portable code, SSE4.2 crc32 (CRC-32C) and
+    PCLMUL folding (ISO-HDLC) kernels. Polynomials without x86 kernels keep
+    portable rows off the kernels. Every row is checked against bitwise result.
+    Then ulCrc32Parallel scaling with POSIX threads executor, 1 to N threads
+    over 64 MiB, table driven CRC-32 (zlib parameters). Every result is
+    checked against the serial call.
+*/
+#include <stdlib.h>
+#include <unistd.h>
+#include "ClBench.h"
+
+#define CRC_BENCH_LEN      (64UL * 1024 * 1024)
+#define CRC_BENCH_POLY     0x04C11DB7UL
+#define CRC_BENCH_OPT      (CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT)
+#define CRC_BENCH_POLY_C   0x1EDC6F41UL
+/* CRC-32/AUTOSAR, reflected like zlib, has no x86 kernel */
+#define CRC_BENCH_POLY_P   0xF4ACFB13UL
+#define CRC_BENCH_BLOCK    (1024 * 1024)
+
+/* Former bitwise engine */
+static uint32_t __attribute__((noinline)) ulCrcBenchBitwise(const uint8_t *pucData, uint32_t ulLen, uint32_t ulInit,
+                                                             uint32_t ulPoly, Crc32Options_t eOpt) {
+	uint32_t crc = ulInit;
+	while (ulLen--) {
+		uint8_t b = *pucData++;
+		if (eOpt & CRC32_REFLECT_IN) b = ulBitReflect(b, 8);
+		crc ^= (uint32_t)b << 24;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & (1UL << 31))? ((crc << 1) ^ ulPoly): (crc << 1);
+		}
+	}
+	if (eOpt & CRC32_INVERT_OUT) crc = ~crc;
+	if (eOpt & CRC32_REFLECT_OUT) crc = ulBitReflect(crc, 32);
+	return crc;
+}
+
+typedef struct {
+	const Crc32Table_t *pxTable;
+	const uint8_t *data;
+	uint32_t len;
+	uint32_t poly;
+	uint32_t crc;
+} CrcBenchBackendArg_t;
+
+static void vCrcBenchBitwise(void *pvArg) {
+	CrcBenchBackendArg_t *arg = (CrcBenchBackendArg_t *)pvArg;
+	arg->crc = ulCrcBenchBitwise(arg->data, arg->len, 0xFFFFFFFFUL, arg->poly, CRC_BENCH_OPT);
+	ulClBenchSink += arg->crc;
+}
+
+static void vCrcBenchNibbles(void *pvArg) {
+	CrcBenchBackendArg_t *arg = (CrcBenchBackendArg_t *)pvArg;
+	arg->crc = ulCrc32(arg->data, arg->len, 0xFFFFFFFFUL, arg->poly, CRC_BENCH_OPT);
+	ulClBenchSink += arg->crc;
+}
+
+static void vCrcBenchTable(void *pvArg) {
+	CrcBenchBackendArg_t *arg = (CrcBenchBackendArg_t *)pvArg;
+	arg->crc = ulCrc32Table(arg->pxTable, arg->data, arg->len, 0xFFFFFFFFUL, CRC_BENCH_OPT);
+	ulClBenchSink += arg->crc;
+}
+
+typedef struct {
+	const Crc32Table_t *pxTable;
+	const uint8_t *data;
+	uint32_t threads;
+	uint32_t crc;
+} CrcBenchArg_t;
+
+static void vCrcBenchRun(void *pvArg) {
+	CrcBenchArg_t *arg = (CrcBenchArg_t *)pvArg;
+	arg->crc = ulCrc32Parallel(arg->data, CRC_BENCH_LEN, arg->threads, 0xFFFFFFFFUL, CRC_BENCH_POLY,
+		CRC_BENCH_OPT, arg->pxTable, vCrcRunPthreads, libNULL);
+	ulClBenchSink += arg->crc;
+}
+
+/* GB/s of every backend and buffer size, returns non zero on mismatch */
+static int lCrcBenchBackends(const uint8_t *pucData) {
+	static Crc32Table_t tables[3];
+	static const uint32_t sizes[] = {4 * 1024, 64 * 1024, CRC_BENCH_BLOCK};
+	static const struct {
+		const char *name;
+		ClBenchRun_t pfRun;
+		uint32_t poly;
+		uint32_t table;
+	} rows[] = {
+		{"bitwise",            vCrcBenchBitwise, CRC_BENCH_POLY,   0},
+		{"nibble",             vCrcBenchNibbles, CRC_BENCH_POLY_P, 2},
+		{"slicing-by-8",       vCrcBenchTable,   CRC_BENCH_POLY_P, 2},
+		{"sse4.2 crc32c",      vCrcBenchTable,   CRC_BENCH_POLY_C, 1},
+		{"pclmul iso-hdlc",    vCrcBenchTable,   CRC_BENCH_POLY,   0},
+	};
+	int res = 0;
+	vCrc32TableInit(&tables[0], CRC_BENCH_POLY, CRC_BENCH_OPT);
+	vCrc32TableInit(&tables[1], CRC_BENCH_POLY_C, CRC_BENCH_OPT);
+	vCrc32TableInit(&tables[2], CRC_BENCH_POLY_P, CRC_BENCH_OPT);
+#ifdef CL_SIMD_X86
+	uint32_t features = ulClCpuFeatures();
+	printf("sse4.2: %s, pclmul: %s\n", (features & CL_CPU_SSE42)? "yes": "no",
+		((features & CL_CPU_PCLMUL) && (features & CL_CPU_SSE41))? "yes": "no");
+#else
+	printf("x86 kernels are not built, kernel rows run portable code\n");
+#endif
+	printf("%-16s %10s %10s %10s   GB/s\n", "backend", "4 KiB", "64 KiB", "1 MiB");
+	for (uint32_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+		CrcBenchBackendArg_t arg = { .pxTable = &tables[rows[r].table], .data = pucData, .poly = rows[r].poly };
+		uint8_t mismatch = 0;
+		printf("%-16s", rows[r].name);
+		for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+			arg.len = sizes[s];
+			double ns = dClBenchNsPerCall(rows[r].pfRun, &arg);
+			mismatch |= (arg.crc != ulCrcBenchBitwise(pucData, arg.len, 0xFFFFFFFFUL, arg.poly, CRC_BENCH_OPT));
+			printf(" %10.2f", dClBenchMbps(ns, arg.len) / 1000);
+		}
+		printf("%s\n", mismatch? "  MISMATCH": "");
+		res |= mismatch;
+	}
+	printf("\n");
+	return res;
+}
+
+int main(void) {
+	static Crc32Table_t table;
+	uint8_t *data = malloc(CRC_BENCH_LEN);
+	if (data == libNULL) {
+		return 1;
+	}
+	for (uint32_t i = 0; i < CRC_BENCH_LEN; i++) {
+		data[i] = (uint8_t)(i * 2654435761UL >> 24);
+	}
+	int res = lCrcBenchBackends(data);
+	vCrc32TableInit(&table, CRC_BENCH_POLY, CRC_BENCH_OPT);
+	uint32_t serial = ulCrc32Table(&table, data, CRC_BENCH_LEN, 0xFFFFFFFFUL, CRC_BENCH_OPT);
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t maxThreads = CL_MIN(CL_MAX(2 * (uint32_t)cpus, 8U), (uint32_t)CRC32_PARALLEL_MAX_SLICES);
+	CrcBenchArg_t arg = { .pxTable = &table, .data = data };
+	double base = 0;
+	printf("%ld cpus, %lu MiB\n%8s %12s %10s\n", cpus, CRC_BENCH_LEN >> 20, "threads", "MB/s", "speedup");
+	for (arg.threads = 1; arg.threads <= maxThreads; arg.threads *= 2) {
+		double ns = dClBenchNsPerCall(vCrcBenchRun, &arg);
+		if (arg.threads == 1) {
+			base = ns;
+		}
+		printf("%8u %12.1f %9.2fx%s\n", arg.threads, dClBenchMbps(ns, CRC_BENCH_LEN), base / ns,
+			(arg.crc == serial)? "": "  MISMATCH");
+		res |= (arg.crc != serial);
+	}
+	free(data);
+	return res;
+}
@@ -0,0 +1,85 @@
+/*!
+    FifoPrintfBench.c
+
+    1 to 16 producer threads print records into one fifo while consumer drains it.
+    Fifo over MpscBuffer is lock-free, fifo over CircularBuffer is guarded by mutex
+    around every print and read, as multi producer logging needed before.
+*/
+#include <pthread.h>
+#include <sched.h>
+#include "ClBench.h"
+#include "ClFifoIface.h"
+
+#define FIFO_BENCH_RECORDS       (64 * 1024)
+#define FIFO_BENCH_STORAGE       (16 * 1024)
+#define FIFO_BENCH_MAX_PRODUCERS 16
+
+static Fifo_t xFifo;
+static uint8_t aucStorage[FIFO_BENCH_STORAGE];
+static pthread_mutex_t xLock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t bLocked;
+static uint32_t ulProducers;
+static uint32_t ulFinished;
+
+static void *pvFifoBenchProducer(void *pvArg) {
+	uint32_t id = (uint32_t)(size_t)pvArg;
+	for (uint32_t i = 0; i < FIFO_BENCH_RECORDS / ulProducers; i++) {
+		int32_t res;
+		do {
+			if (bLocked) pthread_mutex_lock(&xLock);
+			res = lFifoPrintf(&xFifo, "producer %u record %u value %d\n", id, i, (int32_t)(i * 2654435761U));
+			if (bLocked) pthread_mutex_unlock(&xLock);
+			if (res <= 0) sched_yield();
+		} while (res <= 0);
+	}
+	__atomic_fetch_add(&ulFinished, 1, __ATOMIC_RELEASE);
+	return NULL;
+}
+
+static double dFifoBenchRun(uint8_t bMpsc, uint32_t ulCount) {
+	pthread_t producers[FIFO_BENCH_MAX_PRODUCERS];
+	uint8_t chunk[512];
+	Fifo_t fifo = { .pxIface = bMpsc? &xClFifoMpscIface: &xClFifoCbIface, .pxIfaceEx = bMpsc? &xClFifoMpscIfaceEx: libNULL };
+	xFifo = fifo;
+	bFifoInit(&xFifo, aucStorage, sizeof(aucStorage), 0);
+	bLocked = !bMpsc;
+	ulProducers = ulCount;
+	ulFinished = 0;
+	uint64_t start = ullClBenchNowNs();
+	for (uint32_t i = 0; i < ulCount; i++) {
+		pthread_create(&producers[i], NULL, pvFifoBenchProducer, (void *)(size_t)i);
+	}
+	uint8_t finished = 0;
+	while (1) {
+		if (bLocked) pthread_mutex_lock(&xLock);
+		int32_t res = lFifoRead(&xFifo, chunk, sizeof(chunk));
+		if (bLocked) pthread_mutex_unlock(&xLock);
+		if (res > 0) {
+			ulClBenchSink += chunk[0];
+			continue;
+		}
+		/* Empty after all producers finished, nothing left to drain */
+		if (finished) break;
+		finished = (__atomic_load_n(&ulFinished, __ATOMIC_ACQUIRE) == ulCount);
+		if (!finished) sched_yield();
+	}
+	for (uint32_t i = 0; i < ulCount; i++) {
+		pthread_join(producers[i], NULL);
+	}
+	return (double)(ullClBenchNowNs() - start) / (FIFO_BENCH_RECORDS / ulCount * ulCount);
+}
+
+int main(void) {
+	printf("%10s %18s %18s\n", "producers", "mutex ns/record", "mpsc ns/record");
+	for (uint32_t count = 1; count <= FIFO_BENCH_MAX_PRODUCERS; count *= 2) {
+		double locked = dFifoBenchRun(0, count);
+		printf("%10u %18.1f", count, locked);
+		if (CL_FIFO_IFACE_USED) {
+			printf(" %18.1f\n", dFifoBenchRun(1, count));
+		}
+		else {
+			printf(" %18s\n", "-");
+		}
+	}
+	return 0;
+}
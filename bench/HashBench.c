@@ -0,0 +1,125 @@
+/*!
+    HashBench.c
+
+    HashDjb2, HashSdbm, HashKnuth and HashXxh64 throughput for short keys
+    up to 64 KiB blocks, and avalanche quality: each key bit is flipped and
+    output bit flips are counted, ideal flip probability is 0.5 for every
+    input and output bit pair.
+*/
+#include "ClBench.h"
+
+#define HASH_BENCH_MAX          (64 * 1024)
+#define HASH_BENCH_KEY          16
+#define HASH_BENCH_KEYS         2000
+
+typedef uint64_t (*HashBenchFn_t)(void *pvData, uint32_t ulSize);
+
+static uint64_t ullHashBenchDjb2(void *pvData, uint32_t ulSize) {
+	return HashDjb2(pvData, ulSize);
+}
+
+static uint64_t ullHashBenchSdbm(void *pvData, uint32_t ulSize) {
+	return HashSdbm(pvData, ulSize);
+}
+
+static uint64_t ullHashBenchKnuth(void *pvData, uint32_t ulSize) {
+	return HashKnuth(pvData, ulSize);
+}
+
+static uint64_t ullHashBenchXxh64(void *pvData, uint32_t ulSize) {
+	return HashXxh64(pvData, ulSize, 0);
+}
+
+typedef struct {
+	const char *name;
+	HashBenchFn_t pfHash;
+	uint32_t bits;
+} HashBenchAlgo_t;
+
+typedef struct {
+	HashBenchFn_t pfHash;
+	uint8_t *data;
+	uint32_t size;
+} HashBenchArg_t;
+
+static void vHashBenchRun(void *pvArg) {
+	HashBenchArg_t *arg = (HashBenchArg_t *)pvArg;
+	ulClBenchSink += (uint32_t)arg->pfHash(arg->data, arg->size);
+}
+
+static uint32_t ulHashBenchRand(void) {
+	static uint32_t state = 0x9E3779B9;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+/* Flip counts for every key bit and hash bit pair */
+static uint32_t aulFlips[HASH_BENCH_KEY * 8][64];
+
+static void vHashBenchAvalanche(const HashBenchAlgo_t *pxAlgo, double *pdMean, double *pdWorst) {
+	uint8_t key[HASH_BENCH_KEY];
+	mem_set(aulFlips, 0, sizeof(aulFlips));
+	for (uint32_t k = 0; k < HASH_BENCH_KEYS; k++) {
+		for (uint32_t i = 0; i < HASH_BENCH_KEY; i++) {
+			key[i] = (uint8_t)ulHashBenchRand();
+		}
+		uint64_t base = pxAlgo->pfHash(key, HASH_BENCH_KEY);
+		for (uint32_t in = 0; in < HASH_BENCH_KEY * 8; in++) {
+			key[in >> 3] ^= (uint8_t)(1U << (in & 7));
+			uint64_t diff = base ^ pxAlgo->pfHash(key, HASH_BENCH_KEY);
+			key[in >> 3] ^= (uint8_t)(1U << (in & 7));
+			for (uint32_t out = 0; out < pxAlgo->bits; out++) {
+				aulFlips[in][out] += (uint32_t)(diff >> out) & 1;
+			}
+		}
+	}
+	double sum = 0, worst = 0;
+	for (uint32_t in = 0; in < HASH_BENCH_KEY * 8; in++) {
+		for (uint32_t out = 0; out < pxAlgo->bits; out++) {
+			double p = (double)aulFlips[in][out] / HASH_BENCH_KEYS;
+			double bias = (p > 0.5)? (p - 0.5): (0.5 - p);
+			sum += p;
+			worst = (bias > worst)? bias: worst;
+		}
+	}
+	*pdMean = sum / (HASH_BENCH_KEY * 8 * pxAlgo->bits);
+	*pdWorst = worst;
+}
+
+int main(void) {
+	static uint8_t data[HASH_BENCH_MAX];
+	static const HashBenchAlgo_t algos[] = {
+		{"djb2",  ullHashBenchDjb2,  32},
+		{"sdbm",  ullHashBenchSdbm,  32},
+		{"knuth", ullHashBenchKnuth, 32},
+		{"xxh64", ullHashBenchXxh64, 64},
+	};
+	static const uint32_t sizes[] = {8, 16, 32, 256, 4096, HASH_BENCH_MAX};
+	const uint32_t algoCount = sizeof(algos) / sizeof(algos[0]);
+	for (uint32_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)ulHashBenchRand();
+	}
+	printf("%8s", "MB/s");
+	for (uint32_t a = 0; a < algoCount; a++) {
+		printf(" %10s", algos[a].name);
+	}
+	printf("\n");
+	for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+		HashBenchArg_t arg = { .data = data, .size = sizes[s] };
+		printf("%8u", sizes[s]);
+		for (uint32_t a = 0; a < algoCount; a++) {
+			arg.pfHash = algos[a].pfHash;
+			printf(" %10.1f", dClBenchMbps(dClBenchNsPerCall(vHashBenchRun, &arg), sizes[s]));
+		}
+		printf("\n");
+	}
+	printf("\navalanche, %u B keys  %12s %12s\n", HASH_BENCH_KEY, "mean flip", "worst bias");
+	for (uint32_t a = 0; a < algoCount; a++) {
+		double mean, worst;
+		vHashBenchAvalanche(&algos[a], &mean, &worst);
+		printf("%-21s  %12.3f %12.3f\n", algos[a].name, mean, worst);
+	}
+	return 0;
+}
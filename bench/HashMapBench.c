@@ -0,0 +1,84 @@
+/*!
+    HashMapBench.c
+
+    Lookup of register tag names: pvHashMapFind compared with
+    pxLinkedListFindFirst scan, from 16 to 10000 entries.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "ClBench.h"
+
+#define MAP_BENCH_MAX       10000
+#define MAP_BENCH_CAPACITY  16384
+#define MAP_BENCH_TAG       16
+
+typedef struct {
+	__LinkedListObject__
+	char acTag[MAP_BENCH_TAG];
+	uint16_t usTagSize;
+	uint32_t ulValue;
+} MapBenchReg_t;
+
+typedef struct {
+	HashMap_t *map;
+	LinkedList_t list;
+	MapBenchReg_t *regs;
+	uint32_t count;
+	uint32_t next;
+} MapBenchArg_t;
+
+static uint8_t bMapBenchMatch(LinkedListItem_t *pxItem, void *pvTag) {
+	MapBenchReg_t *reg = LinkedListGetObject(MapBenchReg_t, pxItem);
+	const MapBenchReg_t *tag = (const MapBenchReg_t *)pvTag;
+	return (reg->usTagSize == tag->usTagSize) && (memcmp(reg->acTag, tag->acTag, tag->usTagSize) == 0);
+}
+
+/* Tags are looked up in scattered order, every entry equally often */
+static const MapBenchReg_t *pxMapBenchNextTag(MapBenchArg_t *pxArg) {
+	pxArg->next = (pxArg->next + 7919) % pxArg->count;
+	return &pxArg->regs[pxArg->next];
+}
+
+static void vMapBenchFind(void *pvArg) {
+	MapBenchArg_t *arg = (MapBenchArg_t *)pvArg;
+	const MapBenchReg_t *tag = pxMapBenchNextTag(arg);
+	MapBenchReg_t *reg = (MapBenchReg_t *)pvHashMapFind(arg->map, tag->acTag, tag->usTagSize);
+	ulClBenchSink += reg->ulValue;
+}
+
+static void vMapBenchScan(void *pvArg) {
+	MapBenchArg_t *arg = (MapBenchArg_t *)pvArg;
+	const MapBenchReg_t *tag = pxMapBenchNextTag(arg);
+	LinkedListItem_t *item = pxLinkedListFindFirst(arg->list, bMapBenchMatch, (void *)tag);
+	ulClBenchSink += LinkedListGetObject(MapBenchReg_t, item)->ulValue;
+}
+
+int main(void) {
+	static MapBenchReg_t regs[MAP_BENCH_MAX];
+	static HashMapSlot_t slots[MAP_BENCH_CAPACITY];
+	static const uint32_t counts[] = {16, 256, 1024, MAP_BENCH_MAX};
+	HashMap_t map;
+	MapBenchArg_t arg = { .map = &map, .list = libNULL, .regs = regs };
+	for (uint32_t i = 0; i < MAP_BENCH_MAX; i++) {
+		regs[i].usTagSize = (uint16_t)snprintf(regs[i].acTag, MAP_BENCH_TAG, "HR%u.value", i);
+		regs[i].ulValue = i;
+	}
+	printf("%8s %14s %14s %8s\n", "entries", "list ns", "map ns", "speedup");
+	for (uint32_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+		arg.count = counts[c];
+		vLinkedListClear(&arg.list);
+		if (!bHashMapInit(&map, slots, MAP_BENCH_CAPACITY, libNULL)) {
+			return 1;
+		}
+		for (uint32_t i = 0; i < arg.count; i++) {
+			vLinkedListInsertLast(&arg.list, LinkedListItem(&regs[i]));
+			if (!bHashMapInsert(&map, regs[i].acTag, regs[i].usTagSize, &regs[i])) {
+				return 1;
+			}
+		}
+		double scan = dClBenchNsPerCall(vMapBenchScan, &arg);
+		double find = dClBenchNsPerCall(vMapBenchFind, &arg);
+		printf("%8u %14.1f %14.1f %7.1fx\n", arg.count, scan, find, scan / find);
+	}
+	return 0;
+}
@@ -0,0 +1,194 @@
+/*!
+    IntegerStrBench.c
+
+    lLongToStr, lLongLongToStr and lStrToLong compared with digit per step
+    code they replaced, for values of every length. Outputs of both are
+    checked to match. Speedup is the median of old to new time ratios of
+    interleaved batches, so machine load hits both alike. Exit code is not
+    zero if any row is slower than old code.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "ClBench.h"
+
+#define INT_BENCH_VALUES    1024
+#define INT_BENCH_MASK      (INT_BENCH_VALUES - 1)
+#define INT_BENCH_PAIRS     1001
+
+/* Digit per step reference: formatter and parser as they were before table formatting */
+static int32_t __attribute__((noipa)) lRefStrnCpy(char *pcBuffer, const char *pcStr) {
+	int32_t copiedCount = 0;
+	while (*pcStr != '\0') {
+		*pcBuffer++ = *pcStr++;
+		copiedCount++;
+	}
+	*pcBuffer = '\0';
+	return copiedCount;
+}
+
+static int32_t __attribute__((noipa)) lRefLongToStr(char *pcBufer, int32_t lValue) {
+	if (lValue == (int32_t)0x80000000) {
+		return lRefStrnCpy(pcBufer, "-2147483648");
+	}
+	if (lValue == 0) {
+		return lRefStrnCpy(pcBufer, "0");
+	}
+	int32_t count = 11;
+	char longStr[12];
+	int32_t k = lValue;
+	lValue = CL_ABS(lValue);
+	longStr[count] = '\0';
+	while (lValue != 0) {
+		longStr[--count] = '0' + lValue % 10;
+		lValue /= 10;
+	}
+	if (k < 0) {
+		longStr[--count] = '-';
+	}
+	return lRefStrnCpy(pcBufer, &longStr[count]);
+}
+
+static int32_t __attribute__((noipa)) lRefLongLongToStr(char *pcBufer, int64_t llValue) {
+	char longStr[21];
+	int32_t count = 20;
+	uint64_t value = (llValue < 0)? (0 - (uint64_t)llValue): (uint64_t)llValue;
+	longStr[count] = '\0';
+	do {
+		longStr[--count] = '0' + value % 10;
+		value /= 10;
+	} while (value != 0);
+	if (llValue < 0) {
+		longStr[--count] = '-';
+	}
+	return lRefStrnCpy(pcBufer, &longStr[count]);
+}
+
+static int32_t __attribute__((noipa)) lRefStrToLong(uint32_t *pulValue, const char *pcStrValue, uint8_t ucBase) {
+	int32_t result = 0;
+	uint32_t value = 0;
+	uint8_t isSignedInt = 0;
+	if ((ucBase == 10) && ((*pcStrValue == '-') || (*pcStrValue == '+'))) {
+		isSignedInt = (*pcStrValue == '-');
+		pcStrValue++;
+	}
+	while (IS_DIGIT(*pcStrValue) || ((ucBase == 16) && IS_HEX(*pcStrValue))) {
+		uint8_t x = CHAR_TO_HEX(*pcStrValue);
+		if (x >= ucBase) break;
+		++result;
+		value = value * ucBase + x;
+		pcStrValue++;
+	}
+	*pulValue = isSignedInt? ~(value - 1): value;
+	return result;
+}
+
+typedef struct {
+	int32_t alValues[INT_BENCH_VALUES];
+	int64_t allValues[INT_BENCH_VALUES];
+	char acDec[INT_BENCH_VALUES][12];
+	char acHex[INT_BENCH_VALUES][9];
+	char acOut[24];
+	uint32_t next;
+} IntBenchArg_t;
+
+static IntBenchArg_t xArg;
+
+#define INT_BENCH_RUN(name, expr)                                       \
+	static void name(void *pvArg) {                                     \
+		IntBenchArg_t *arg = (IntBenchArg_t *)pvArg;                    \
+		uint32_t i = arg->next++ & INT_BENCH_MASK;                      \
+		uint32_t value = 0;                                             \
+		ulClBenchSink += (uint32_t)(expr) + value;                      \
+	}
+
+INT_BENCH_RUN(vIntBenchRefFormat32, lRefLongToStr(arg->acOut, arg->alValues[i]))
+INT_BENCH_RUN(vIntBenchFormat32, lLongToStr(arg->acOut, arg->alValues[i]))
+INT_BENCH_RUN(vIntBenchRefFormat64, lRefLongLongToStr(arg->acOut, arg->allValues[i]))
+INT_BENCH_RUN(vIntBenchFormat64, lLongLongToStr(arg->acOut, arg->allValues[i]))
+INT_BENCH_RUN(vIntBenchRefParse10, lRefStrToLong(&value, arg->acDec[i], 10))
+INT_BENCH_RUN(vIntBenchParse10, lStrToLong(&value, arg->acDec[i], 10))
+INT_BENCH_RUN(vIntBenchRefParse16, lRefStrToLong(&value, arg->acHex[i], 16))
+INT_BENCH_RUN(vIntBenchParse16, lStrToLong(&value, arg->acHex[i], 16))
+
+/* Compare outputs of both versions for every value */
+static uint8_t bIntBenchCheck(void) {
+	char ref[24];
+	for (uint32_t i = 0; i < INT_BENCH_VALUES; i++) {
+		uint32_t refValue, value;
+		if ((lRefLongToStr(ref, xArg.alValues[i]) != lLongToStr(xArg.acOut, xArg.alValues[i])) ||
+		    (strcmp(ref, xArg.acOut) != 0) ||
+		    (lRefLongLongToStr(ref, xArg.allValues[i]) != lLongLongToStr(xArg.acOut, xArg.allValues[i])) ||
+		    (strcmp(ref, xArg.acOut) != 0) ||
+		    (lRefStrToLong(&refValue, xArg.acDec[i], 10) != lStrToLong(&value, xArg.acDec[i], 10)) || (refValue != value) ||
+		    (lRefStrToLong(&refValue, xArg.acHex[i], 16) != lStrToLong(&value, xArg.acHex[i], 16)) || (refValue != value)) {
+			return CL_FALSE;
+		}
+	}
+	return CL_TRUE;
+}
+
+static int iIntBenchCompare(const void *pvA, const void *pvB) {
+	double a = *(const double *)pvA;
+	double b = *(const double *)pvB;
+	return (a > b) - (a < b);
+}
+
+/* Old and new batches of every value run in turns, median ratio is stable on a loaded machine */
+static double dIntBenchSpeedup(ClBenchRun_t pfOld, ClBenchRun_t pfNew) {
+	static double ratios[INT_BENCH_PAIRS];
+	for (uint32_t k = 0; k < INT_BENCH_PAIRS; k++) {
+		uint64_t start = ullClBenchNowNs();
+		for (uint32_t i = 0; i < INT_BENCH_VALUES; i++) {
+			pfOld(&xArg);
+		}
+		uint64_t middle = ullClBenchNowNs();
+		for (uint32_t i = 0; i < INT_BENCH_VALUES; i++) {
+			pfNew(&xArg);
+		}
+		uint64_t end = ullClBenchNowNs();
+		ratios[k] = (double)(middle - start) / (double)((end > middle)? (end - middle): 1);
+	}
+	qsort(ratios, INT_BENCH_PAIRS, sizeof(ratios[0]), iIntBenchCompare);
+	return ratios[INT_BENCH_PAIRS / 2];
+}
+
+int main(void) {
+	static const struct {
+		const char *name;
+		ClBenchRun_t pfOld;
+		ClBenchRun_t pfNew;
+	} runs[] = {
+		{"format int32", vIntBenchRefFormat32, vIntBenchFormat32},
+		{"format int64", vIntBenchRefFormat64, vIntBenchFormat64},
+		{"parse dec",    vIntBenchRefParse10,  vIntBenchParse10},
+		{"parse hex",    vIntBenchRefParse16,  vIntBenchParse16},
+	};
+	/* Lengths are spread evenly, value i has about i % 10 + 1 digits */
+	uint64_t seed = 0x9E3779B97F4A7C15ULL;
+	for (uint32_t i = 0; i < INT_BENCH_VALUES; i++) {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		static const uint32_t limits[] = {10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 0};
+		uint32_t limit = limits[i % 10];
+		uint32_t magnitude = limit? (uint32_t)(seed % limit): (uint32_t)seed;
+		xArg.alValues[i] = (int32_t)((i & 1)? (0 - magnitude): magnitude);
+		xArg.allValues[i] = (int64_t)((i & 1)? (0 - (seed >> (i % 60))): (seed >> (i % 60)));
+		lRefLongToStr(xArg.acDec[i], xArg.alValues[i]);
+		snprintf(xArg.acHex[i], sizeof(xArg.acHex[i]), "%x", magnitude);
+	}
+	if (!bIntBenchCheck()) {
+		printf("MISMATCH\n");
+		return 1;
+	}
+	int res = 0;
+	printf("%-14s %12s %12s %8s\n", "", "old ns", "new ns", "speedup");
+	for (uint32_t r = 0; r < sizeof(runs) / sizeof(runs[0]); r++) {
+		double old = dClBenchNsPerCall(runs[r].pfOld, &xArg);
+		double new = dClBenchNsPerCall(runs[r].pfNew, &xArg);
+		double speedup = dIntBenchSpeedup(runs[r].pfOld, runs[r].pfNew);
+		printf("%-14s %12.1f %12.1f %7.2fx%s\n", runs[r].name, old, new, speedup, (speedup < 1.0)? "  SLOWER": "");
+		res |= (speedup < 1.0);
+	}
+	return res;
+}
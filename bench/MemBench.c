@@ -0,0 +1,99 @@
+/*!
+    MemBench.c
+
+    mem_cpy, mem_move, mem_set and mem_cmp compared with libc
+    for sizes from 1 B to 1 MiB, buffers start one byte off alignment.
+*/
+#include <string.h>
+#include "ClBench.h"
+
+#define MEM_BENCH_MAX     (1024 * 1024)
+
+typedef struct {
+	uint8_t *dst;
+	uint8_t *src;
+	size_t count;
+} MemBenchArg_t;
+
+static void vMemBenchCpy(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	mem_cpy(arg->dst, arg->src, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+static void vMemBenchLibcCpy(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	memcpy(arg->dst, arg->src, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+/* Overlapping move by 3 bytes backward, the way buffers get compacted */
+static void vMemBenchMove(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	mem_move(arg->dst, arg->dst + 3, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+static void vMemBenchLibcMove(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	memmove(arg->dst, arg->dst + 3, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+static void vMemBenchSet(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	mem_set(arg->dst, (uint8_t)arg->count, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+static void vMemBenchLibcSet(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	memset(arg->dst, (uint8_t)arg->count, arg->count);
+	ulClBenchSink += arg->dst[0];
+}
+
+/* Equal buffers, whole range is compared */
+static void vMemBenchCmp(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	ulClBenchSink += mem_cmp(arg->dst, arg->src, arg->count);
+}
+
+static void vMemBenchLibcCmp(void *pvArg) {
+	MemBenchArg_t *arg = (MemBenchArg_t *)pvArg;
+	ulClBenchSink += memcmp(arg->dst, arg->src, arg->count);
+}
+
+typedef struct {
+	const char *name;
+	ClBenchRun_t pfLib;
+	ClBenchRun_t pfLibc;
+	uint8_t bEqual;
+} MemBenchOp_t;
+
+int main(void) {
+	static uint8_t dst[MEM_BENCH_MAX + 64], src[MEM_BENCH_MAX + 64];
+	static const MemBenchOp_t ops[] = {
+		{"mem_cpy",  vMemBenchCpy,  vMemBenchLibcCpy,  CL_FALSE},
+		{"mem_move", vMemBenchMove, vMemBenchLibcMove, CL_FALSE},
+		{"mem_set",  vMemBenchSet,  vMemBenchLibcSet,  CL_FALSE},
+		{"mem_cmp",  vMemBenchCmp,  vMemBenchLibcCmp,  CL_TRUE},
+	};
+	MemBenchArg_t arg = { .dst = dst + 1, .src = src + 1 };
+	for (uint32_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 131);
+	}
+	printf("%-9s %8s %14s %14s %8s\n", "op", "bytes", "libc MB/s", "lib MB/s", "ratio");
+	for (uint32_t op = 0; op < sizeof(ops) / sizeof(ops[0]); op++) {
+		for (size_t count = 1; count <= MEM_BENCH_MAX; count *= 4) {
+			arg.count = count;
+			if (ops[op].bEqual) {
+				memcpy(arg.dst, arg.src, count);
+			}
+			double libc = dClBenchNsPerCall(ops[op].pfLibc, &arg);
+			double lib = dClBenchNsPerCall(ops[op].pfLib, &arg);
+			printf("%-9s %8zu %14.1f %14.1f %7.2fx\n", ops[op].name, count,
+				dClBenchMbps(libc, count), dClBenchMbps(lib, count), libc / lib);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,190 @@
+/*!
+    ModbusRtuBench.c
+
+    CRC16 Modbus check of a stream of back-to-back 256 byte RTU frames
+    (write holdings requests): former bitwise code, 256 entry table and
+    slicing-by-4 loops, then usCrc16ModbusRtu and the whole ModBus server
+    parser of this build. Configure with -DCL_CRC16_SLICING_BY_4=ON to get
+    the slicing-by-4 library and parser rows. Every frame carries CRC from
+    the bitwise reference, every row must accept all of them.
+*/
+#include "ClBench.h"
+
+#define MODBUS_BENCH_FRAME      256
+#define MODBUS_BENCH_FRAMES     256
+#define MODBUS_BENCH_DATA       (MODBUS_BENCH_FRAME - 9)
+
+#ifdef CL_CRC16_SLICING_BY_4
+#define MODBUS_BENCH_VARIANT    "slicing-by-4"
+#else
+#define MODBUS_BENCH_VARIANT    "table"
+#endif
+
+/* Former bitwise usCrc16ModbusRtu */
+static uint16_t __attribute__((noinline)) usModbusBenchBitwise(const uint8_t *pucData, uint16_t usLen) {
+	uint16_t crc = 0xFFFF;
+	while (usLen--) {
+		crc ^= *pucData++;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & 1)? ((crc >> 1) ^ 0xA001): (crc >> 1);
+		}
+	}
+	return crc;
+}
+
+/* Same loops as Crc.c, tables built from bitwise code */
+static uint16_t ausModbusBenchTable[4][256];
+
+static uint16_t __attribute__((noinline)) usModbusBenchTable(const uint8_t *pucData, uint16_t usLen) {
+	uint16_t crc = 0xFFFF;
+	while (usLen--) {
+		crc = (crc >> 8) ^ ausModbusBenchTable[0][(crc ^ *pucData++) & 0xFF];
+	}
+	return crc;
+}
+
+static uint16_t __attribute__((noinline)) usModbusBenchSlicing(const uint8_t *pucData, uint16_t usLen) {
+	uint16_t crc = 0xFFFF;
+	for (; usLen >= 4; usLen -= 4, pucData += 4) {
+		uint16_t x = crc ^ ((uint16_t)pucData[0] | ((uint16_t)pucData[1] << 8));
+		crc = ausModbusBenchTable[3][x & 0xFF] ^ ausModbusBenchTable[2][x >> 8] ^
+		      ausModbusBenchTable[1][pucData[2]] ^ ausModbusBenchTable[0][pucData[3]];
+	}
+	while (usLen--) {
+		crc = (crc >> 8) ^ ausModbusBenchTable[0][(crc ^ *pucData++) & 0xFF];
+	}
+	return crc;
+}
+
+static uint16_t usModbusBenchLibrary(const uint8_t *pucData, uint16_t usLen) {
+	return usCrc16ModbusRtu(pucData, usLen, libNULL);
+}
+
+static void vModbusBenchTableInit(void) {
+	for (uint32_t i = 0; i < 256; i++) {
+		/* CRC of a single byte from zero state */
+		uint16_t crc = (uint16_t)i;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & 1)? ((crc >> 1) ^ 0xA001): (crc >> 1);
+		}
+		ausModbusBenchTable[0][i] = crc;
+	}
+	for (uint32_t k = 1; k < 4; k++) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint16_t prev = ausModbusBenchTable[k - 1][i];
+			ausModbusBenchTable[k][i] = (prev >> 8) ^ ausModbusBenchTable[0][prev & 0xFF];
+		}
+	}
+}
+
+typedef struct {
+	uint16_t (*pfCrc)(const uint8_t *pucData, uint16_t usLen);
+	const uint8_t *stream;
+	Modbus_t *mb;
+	uint32_t ok;
+} ModbusBenchArg_t;
+
+/* CRC check of every frame, counts frames with matching CRC */
+static void vModbusBenchCrcRun(void *pvArg) {
+	ModbusBenchArg_t *arg = (ModbusBenchArg_t *)pvArg;
+	uint32_t ok = 0;
+	for (uint32_t f = 0; f < MODBUS_BENCH_FRAMES; f++) {
+		const uint8_t *frame = &arg->stream[f * MODBUS_BENCH_FRAME];
+		uint16_t crc = arg->pfCrc(frame, MODBUS_BENCH_FRAME - 2);
+		ok += (crc == ((uint16_t)frame[MODBUS_BENCH_FRAME - 2] | ((uint16_t)frame[MODBUS_BENCH_FRAME - 1] << 8)));
+	}
+	arg->ok = ok;
+	ulClBenchSink += ok;
+}
+
+/* Whole server path: receive, parse, request callback */
+static void vModbusBenchParserRun(void *pvArg) {
+	ModbusBenchArg_t *arg = (ModbusBenchArg_t *)pvArg;
+	arg->ok = 0;
+	for (uint32_t f = 0; f < MODBUS_BENCH_FRAMES; f++) {
+		vModbusReceiveData(arg->mb, &arg->stream[f * MODBUS_BENCH_FRAME], MODBUS_BENCH_FRAME, CL_TRUE);
+		vModbusWork(arg->mb);
+	}
+	ulClBenchSink += arg->ok;
+}
+
+static void vModbusBenchOnRequest(ModbusFrame_t *pxFrame, Modbus_t *pxMb, void *pxContext) {
+	ModbusBenchArg_t *arg = (ModbusBenchArg_t *)pxContext;
+	arg->ok += (pxFrame->ucFunc == MB_FUNC_WRITE_HOLDINGS) && (pxFrame->ucLengthCode == MODBUS_BENCH_DATA);
+	/* No response, back to listening */
+	bModbusReset(pxMb);
+}
+
+static int32_t lModbusBenchWrite(void *pxPhy, const uint8_t *pucBuf, uint16_t ulSize) {
+	libUNUSED(pxPhy);
+	libUNUSED(pucBuf);
+	return ulSize;
+}
+
+static uint32_t ulModbusBenchTimer(const void *pxTimerPhy) {
+	libUNUSED(pxTimerPhy);
+	return 0;
+}
+
+int main(void) {
+	static uint8_t stream[MODBUS_BENCH_FRAMES * MODBUS_BENCH_FRAME];
+	static uint8_t payload[MODBUS_BENCH_FRAME];
+	static const ModbusIface_t iface = { .pfWrite = lModbusBenchWrite, .pfTimer = ulModbusBenchTimer };
+	static const struct {
+		const char *name;
+		uint16_t (*pfCrc)(const uint8_t *pucData, uint16_t usLen);
+	} rows[] = {
+		{"bitwise",                              usModbusBenchBitwise},
+		{"table",                                usModbusBenchTable},
+		{"slicing-by-4",                         usModbusBenchSlicing},
+		{"crc16 lib " MODBUS_BENCH_VARIANT,      usModbusBenchLibrary},
+	};
+	int res = 0;
+	vModbusBenchTableInit();
+	for (uint32_t f = 0; f < MODBUS_BENCH_FRAMES; f++) {
+		uint8_t *frame = &stream[f * MODBUS_BENCH_FRAME];
+		uint16_t count = MODBUS_BENCH_DATA / 2;
+		frame[0] = (uint8_t)(1 + f % 247);
+		frame[1] = MB_FUNC_WRITE_HOLDINGS;
+		frame[2] = (uint8_t)(f >> 8);
+		frame[3] = (uint8_t)f;
+		frame[4] = (uint8_t)(count >> 8);
+		frame[5] = (uint8_t)count;
+		frame[6] = MODBUS_BENCH_DATA;
+		for (uint32_t i = 7; i < MODBUS_BENCH_FRAME - 2; i++) {
+			frame[i] = (uint8_t)((f * MODBUS_BENCH_FRAME + i) * 2654435761UL >> 24);
+		}
+		uint16_t crc = usModbusBenchBitwise(frame, MODBUS_BENCH_FRAME - 2);
+		frame[MODBUS_BENCH_FRAME - 2] = (uint8_t)crc;
+		frame[MODBUS_BENCH_FRAME - 1] = (uint8_t)(crc >> 8);
+	}
+	printf("%u frames of %u bytes, library built with %s\n", MODBUS_BENCH_FRAMES, MODBUS_BENCH_FRAME,
+		MODBUS_BENCH_VARIANT);
+	printf("%-28s %12s %10s\n", "crc16", "frames/s", "MB/s");
+	for (uint32_t r = 0; r < sizeof(rows) / sizeof(rows[0]); r++) {
+		ModbusBenchArg_t arg = { .pfCrc = rows[r].pfCrc, .stream = stream };
+		double ns = dClBenchNsPerCall(vModbusBenchCrcRun, &arg);
+		uint8_t mismatch = (arg.ok != MODBUS_BENCH_FRAMES);
+		printf("%-28s %12.0f %10.1f%s\n", rows[r].name, MODBUS_BENCH_FRAMES * 1e9 / ns,
+			dClBenchMbps(ns, sizeof(stream)), mismatch? "  MISMATCH": "");
+		res |= mismatch;
+	}
+
+	Modbus_t mb;
+	ModbusBenchArg_t arg = { .stream = stream, .mb = &mb };
+	ModbusConfig_t config = {
+		.pxIface = &iface, .pxRequestContext = &arg, .pucPayLoadBuffer = payload,
+		.ucPayLoadBufferSize = sizeof(payload), .usTxTimeout = 100, .usRxTimeout = 100,
+		.eMode = MB_MODE_RTU, .bIsServer = CL_TRUE, .pfOnRequest = vModbusBenchOnRequest
+	};
+	if (!bModbusInit(&mb, &config)) {
+		printf("modbus init failed\n");
+		return 1;
+	}
+	double ns = dClBenchNsPerCall(vModbusBenchParserRun, &arg);
+	uint8_t mismatch = (arg.ok != MODBUS_BENCH_FRAMES);
+	printf("%-28s %12.0f %10.1f%s\n", "parser " MODBUS_BENCH_VARIANT, MODBUS_BENCH_FRAMES * 1e9 / ns,
+		dClBenchMbps(ns, sizeof(stream)), mismatch? "  MISMATCH": "");
+	res |= mismatch;
+	return res;
+}
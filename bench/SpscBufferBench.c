@@ -0,0 +1,85 @@
+/*!
+    SpscBufferBench.c
+
+    Ping-pong round trip latency between two threads over pair of SpscCircularBuffer,
+    and one way streaming throughput with bulk read and write.
+    Waiting side yields, so results stay meaningful on hosts with single CPU.
+*/
+#include <pthread.h>
+#include <sched.h>
+#include "ClBench.h"
+
+#define SPSC_BENCH_SIZE          1024
+#define SPSC_BENCH_ROUND_TRIPS   200000
+#define SPSC_BENCH_STREAM_BYTES  (256UL * 1024 * 1024)
+#define SPSC_BENCH_CHUNK         256
+
+static SpscCircularBuffer_t xPing, xPong;
+static uint8_t aucPing[SPSC_BENCH_SIZE], aucPong[SPSC_BENCH_SIZE];
+
+static void *pvSpscBenchEcho(void *pvArg) {
+	libUNUSED(pvArg);
+	uint8_t value;
+	for (uint32_t i = 0; i < SPSC_BENCH_ROUND_TRIPS; i++) {
+		while (!bScbSpscPop(&xPing, &value)) {
+			sched_yield();
+		}
+		while (!bScbSpscPush(&xPong, value)) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void *pvSpscBenchSink(void *pvArg) {
+	libUNUSED(pvArg);
+	uint8_t chunk[SPSC_BENCH_CHUNK];
+	uint32_t sum = 0;
+	for (uint64_t received = 0; received < SPSC_BENCH_STREAM_BYTES; ) {
+		int32_t res = scb_spsc_read(&xPing, chunk, sizeof(chunk));
+		if (res == 0) {
+			sched_yield();
+		}
+		sum += chunk[0];
+		received += res;
+	}
+	ulClBenchSink += sum;
+	return NULL;
+}
+
+int main(void) {
+	pthread_t peer;
+	uint8_t chunk[SPSC_BENCH_CHUNK] = {0};
+	vScbSpscInit(&xPing, aucPing, SPSC_BENCH_SIZE);
+	vScbSpscInit(&xPong, aucPong, SPSC_BENCH_SIZE);
+
+	pthread_create(&peer, NULL, pvSpscBenchEcho, NULL);
+	uint64_t start = ullClBenchNowNs();
+	for (uint32_t i = 0; i < SPSC_BENCH_ROUND_TRIPS; i++) {
+		uint8_t value = (uint8_t)i;
+		while (!bScbSpscPush(&xPing, value)) {
+			sched_yield();
+		}
+		while (!bScbSpscPop(&xPong, &value)) {
+			sched_yield();
+		}
+		ulClBenchSink += value;
+	}
+	uint64_t elapsed = ullClBenchNowNs() - start;
+	pthread_join(peer, NULL);
+	printf("ping-pong round trip: %.1f ns\n", (double)elapsed / SPSC_BENCH_ROUND_TRIPS);
+
+	pthread_create(&peer, NULL, pvSpscBenchSink, NULL);
+	start = ullClBenchNowNs();
+	for (uint64_t sent = 0; sent < SPSC_BENCH_STREAM_BYTES; ) {
+		int32_t res = scb_spsc_write(&xPing, chunk, sizeof(chunk));
+		if (res == 0) {
+			sched_yield();
+		}
+		sent += res;
+	}
+	pthread_join(peer, NULL);
+	elapsed = ullClBenchNowNs() - start;
+	printf("stream %u B chunks: %.1f MB/s\n", SPSC_BENCH_CHUNK, dClBenchMbps((double)elapsed, SPSC_BENCH_STREAM_BYTES));
+	return 0;
+}
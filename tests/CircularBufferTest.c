@@ -0,0 +1,83 @@
+/*!
+    CircularBufferTest.c
+
+    Random writes and reads against plain array model, checks data order
+    and counters across wraparound for both segment paths.
+*/
+#include <string.h>
+#include "ClTest.h"
+
+#define CB_TEST_SIZE     (sizeof(CircularBuffer_t) + 3 + 251)
+#define CB_TEST_STEPS    200000
+
+static uint8_t aucModel[4096];
+static uint32_t ulModelCount;
+
+static void vModelPush(const uint8_t *pucData, uint32_t ulCount, uint8_t bFill) {
+	for (uint32_t i = 0; i < ulCount; i++) {
+		aucModel[ulModelCount++] = bFill? pucData[0]: pucData[i];
+	}
+}
+
+static void vModelPop(uint32_t ulCount) {
+	memmove(aucModel, aucModel + ulCount, ulModelCount - ulCount);
+	ulModelCount -= ulCount;
+}
+
+int main(void) {
+	static uint8_t storage[CB_TEST_SIZE];
+	uint8_t in[300], out[300];
+	CircularBuffer_t *cb = pxCircularBufferInit(storage, sizeof(storage));
+	CL_TEST_CHECK(cb != libNULL);
+	int32_t size = lCircularBufferFree(cb);
+	CL_TEST_CHECK(size > 0);
+	for (uint32_t step = 0; step < CB_TEST_STEPS; step++) {
+		uint32_t op = ulClTestRand() % 8;
+		uint32_t count = ulClTestRand() % (size + 8);
+		uint32_t free = size - ulModelCount;
+		for (uint32_t i = 0; i < count; i++) {
+			in[i] = (uint8_t)ulClTestRand() | 1;
+		}
+		if (op < 3) {
+			uint8_t fill = (op == 1);
+			uint8_t all = (op == 2);
+			int32_t res = lCircularBufferWrite(cb, in, count, fill, all, 0);
+			uint32_t exp = CL_MIN(count, free);
+			if (all && (exp != count)) {
+				CL_TEST_CHECK(res == -1);
+			}
+			else {
+				CL_TEST_CHECK(res == (int32_t)exp);
+				vModelPush(in, exp, fill);
+			}
+		}
+		else if (op == 3) {
+			/* String mode stops at terminator */
+			uint32_t len = count? (ulClTestRand() % count): 0;
+			in[len] = '\0';
+			int32_t res = lCircularBufferWrite(cb, in, count, 0, 0, 1);
+			uint32_t exp = CL_MIN(CL_MIN(count, free), len);
+			CL_TEST_CHECK(res == (int32_t)exp);
+			vModelPush(in, exp, 0);
+		}
+		else {
+			uint32_t skip = (op == 7)? (ulClTestRand() % 16): 0;
+			uint8_t peek = (op == 6);
+			int32_t res = lCircularBufferRead(cb, out, count, skip, peek);
+			uint32_t skipped = CL_MIN(skip, ulModelCount);
+			uint32_t exp = CL_MIN(count, ulModelCount - skipped);
+			CL_TEST_CHECK(res == (int32_t)((ulModelCount && (count || skip))? (exp + skipped): 0));
+			CL_TEST_CHECK(memcmp(out, aucModel + skipped, exp) == 0);
+			if (!peek) {
+				vModelPop(exp + skipped);
+			}
+		}
+		CL_TEST_CHECK(lCircularBufferAvailable(cb) == (int32_t)ulModelCount);
+		CL_TEST_CHECK(lCircularBufferFree(cb) == size - (int32_t)ulModelCount);
+		if (_ulClTestFailed) {
+			printf("step %u op %u count %u\n", step, op, count);
+			break;
+		}
+	}
+	return CL_TEST_RESULT();
+}
@@ -0,0 +1,78 @@
+/*!
+    ClFifoIface.h
+
+    Fifo buffer interfaces over CircularBuffer and MpscBuffer shared by host
+    tests and benchmarks. Every file uses only some of them.
+*/
+#ifndef CL_FIFO_IFACE_H_INCLUDED
+#define CL_FIFO_IFACE_H_INCLUDED
+
+#include "CodeLib.h"
+
+/* CL_FIFO_STATIC_CIRCULAR_BUFFER ignores interfaces, fifo is always over CircularBuffer then */
+#ifdef CL_FIFO_STATIC_CIRCULAR_BUFFER
+#define CL_FIFO_IFACE_USED      CL_FALSE
+#else
+#define CL_FIFO_IFACE_USED      CL_TRUE
+#endif
+
+static inline uint8_t _bClFifoIsInIsr(void) { return 0; }
+
+static inline void *_pvClCbInit(uint8_t *pucBuffer, BufferSize_t uSize) { return pxCircularBufferInit(pucBuffer, uSize); }
+static inline int32_t _lClCbAvailable(void *pvBuf) { return lCircularBufferAvailable(pvBuf); }
+static inline int32_t _lClCbFree(void *pvBuf) { return lCircularBufferFree(pvBuf); }
+static inline int32_t _lClCbFlush(void *pvBuf) { vCircularBufferFlush(pvBuf); return 0; }
+static inline int32_t _lClCbRead(void *pvBuf, uint8_t *pucDest, BufferSize_t uTake, BufferSize_t uSkip, uint8_t bPeek) {
+	return lCircularBufferRead(pvBuf, pucDest, uTake, uSkip, bPeek);
+}
+static inline int32_t _lClCbWrite(void *pvBuf, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFill, uint8_t bAll, uint8_t bStr) {
+	return lCircularBufferWrite(pvBuf, pucData, uCount, bFill, bAll, bStr);
+}
+static inline uint8_t _bClCbBackup(void *pvBuf) { return bCircularBufferBackup(pvBuf); }
+static inline uint8_t _bClCbCommit(void *pvBuf) { return bCircularBufferCommit(pvBuf); }
+static inline uint8_t _bClCbRestore(void *pvBuf) { return bCircularBufferRestore(pvBuf); }
+static inline int32_t _lClCbReserve(void *pvBuf, uint8_t **ppucSpace) { return lCircularBufferWriteReserve(pvBuf, ppucSpace); }
+static inline int32_t _lClCbWrCommit(void *pvBuf, BufferSize_t uCount) { return lCircularBufferWriteCommit(pvBuf, uCount); }
+static inline int32_t _lClCbSpan(void *pvBuf, BufferSize_t uSkip, const uint8_t **ppucSpan) {
+	return lCircularBufferReadSpan(pvBuf, uSkip, ppucSpan);
+}
+
+static inline void *_pvClMpscInit(uint8_t *pucBuffer, BufferSize_t uSize) { return pxMpscBufferInit(pucBuffer, uSize); }
+static inline int32_t _lClMpscAvailable(void *pvBuf) { return lMpscBufferAvailable(pvBuf); }
+static inline int32_t _lClMpscFree(void *pvBuf) { return lMpscBufferFree(pvBuf); }
+static inline int32_t _lClMpscFlush(void *pvBuf) { vMpscBufferFlush(pvBuf); return 0; }
+static inline int32_t _lClMpscRead(void *pvBuf, uint8_t *pucDest, BufferSize_t uTake, BufferSize_t uSkip, uint8_t bPeek) {
+	return lMpscBufferRead(pvBuf, pucDest, uTake, uSkip, bPeek);
+}
+static inline int32_t _lClMpscWrite(void *pvBuf, const uint8_t *pucData, BufferSize_t uCount, uint8_t bFill, uint8_t bAll, uint8_t bStr) {
+	return lMpscBufferWrite(pvBuf, pucData, uCount, bFill, bAll, bStr);
+}
+static inline int32_t _lClMpscClaim(void *pvBuf, BufferSize_t uCount, uint8_t *apucSpans[2], uint32_t *pulTicket) {
+	return lMpscBufferClaim(pvBuf, uCount, apucSpans, pulTicket);
+}
+static inline void _vClMpscPublish(void *pvBuf, uint32_t ulTicket, BufferSize_t uCount) {
+	vMpscBufferPublish(pvBuf, ulTicket, uCount);
+}
+
+/* CircularBuffer: base methods, backup and zero-copy extensions */
+static const FifoIface_t xClFifoCbIface __attribute__((unused)) = {
+	.pfBufferInit = _pvClCbInit, .pfBufferAvailable = _lClCbAvailable, .pfBufferFree = _lClCbFree,
+	.pfBufferFlush = _lClCbFlush, .pfBufferRead = _lClCbRead, .pfBufferWrite = _lClCbWrite,
+	.pfIsInIsr = _bClFifoIsInIsr
+};
+static const FifoIfaceEx_t xClFifoCbIfaceEx __attribute__((unused)) = {
+	.pfBufferBackup = _bClCbBackup, .pfBufferCommit = _bClCbCommit, .pfBufferRestore = _bClCbRestore,
+	.pfBufferWriteReserve = _lClCbReserve, .pfBufferWriteCommit = _lClCbWrCommit, .pfBufferReadSpan = _lClCbSpan
+};
+
+/* MpscBuffer: base methods, claim and publish for concurrent producers */
+static const FifoIface_t xClFifoMpscIface __attribute__((unused)) = {
+	.pfBufferInit = _pvClMpscInit, .pfBufferAvailable = _lClMpscAvailable, .pfBufferFree = _lClMpscFree,
+	.pfBufferFlush = _lClMpscFlush, .pfBufferRead = _lClMpscRead, .pfBufferWrite = _lClMpscWrite,
+	.pfIsInIsr = _bClFifoIsInIsr
+};
+static const FifoIfaceEx_t xClFifoMpscIfaceEx __attribute__((unused)) = {
+	.pfBufferClaim = _lClMpscClaim, .pfBufferPublish = _vClMpscPublish
+};
+
+#endif /* CL_FIFO_IFACE_H_INCLUDED */
@@ -0,0 +1,34 @@
+/*!
+    ClTest.h
+
+    Minimal host test helpers. Test executable prints failed checks
+    and returns non zero exit code if any check failed.
+*/
+#ifndef CL_TEST_H_INCLUDED
+#define CL_TEST_H_INCLUDED
+
+#include <stdio.h>
+#include "CodeLib.h"
+
+static uint32_t _ulClTestFailed;
+static uint32_t _ulClTestSeed = 0x9E3779B9;
+
+#define CL_TEST_CHECK(cond) do { \
+		if (!(cond)) { \
+			_ulClTestFailed++; \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+		} \
+	} while (0)
+
+/* Test result for main return */
+#define CL_TEST_RESULT()    (printf("%s\n", _ulClTestFailed? "FAILED": "OK"), (_ulClTestFailed != 0))
+
+/* xorshift32, tests are reproducible */
+static inline uint32_t ulClTestRand(void) {
+	_ulClTestSeed ^= _ulClTestSeed << 13;
+	_ulClTestSeed ^= _ulClTestSeed >> 17;
+	_ulClTestSeed ^= _ulClTestSeed << 5;
+	return _ulClTestSeed;
+}
+
+#endif /* CL_TEST_H_INCLUDED */
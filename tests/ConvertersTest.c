@@ -0,0 +1,311 @@
+/*!
+    ConvertersTest.c
+
+    Base64 round trips of random data 0 to 700 bytes against a simple
+    sextet encoder, invalid chars and misplaced padding. CP1251 to UTF-8
+    of ASCII runs with high bytes at every offset against a byte per step
+    converter, ulAsciiToUtf8Bounded truncation at every output size.
+    Hex round trips with mixed case, HEX_DECODE_ERROR_POSITION() of invalid
+    chars and odd lengths.
+*/
+#include <string.h>
+#include "ClTest.h"
+
+#define CONV_TEST_MAX       700
+#define CONV_TEST_ROUNDS    3000
+
+static const char acBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static uint8_t aucData[CONV_TEST_MAX + 16];
+static uint8_t aucText[4 * CONV_TEST_MAX + 16];
+static uint8_t aucOut[4 * CONV_TEST_MAX + 16];
+
+static void vConvTestRandom(uint8_t *pucBuf, uint32_t ulLen) {
+	for (uint32_t i = 0; i < ulLen; i++) {
+		pucBuf[i] = (uint8_t)ulClTestRand();
+	}
+}
+
+/* Sextet per step, '=' padding */
+static uint32_t ulConvTestBase64Ref(char *pcOut, const uint8_t *pucData, uint32_t ulLen) {
+	uint32_t n = 0;
+	for (uint32_t i = 0; i < ulLen; i += 3) {
+		uint32_t rest = CL_MIN(ulLen - i, 3U);
+		uint32_t block = (uint32_t)pucData[i] << 16;
+		if (rest > 1) block |= (uint32_t)pucData[i + 1] << 8;
+		if (rest > 2) block |= pucData[i + 2];
+		pcOut[n++] = acBase64Alphabet[(block >> 18) & 0x3F];
+		pcOut[n++] = acBase64Alphabet[(block >> 12) & 0x3F];
+		pcOut[n++] = (rest > 1)? acBase64Alphabet[(block >> 6) & 0x3F]: '=';
+		pcOut[n++] = (rest > 2)? acBase64Alphabet[block & 0x3F]: '=';
+	}
+	return n;
+}
+
+static uint8_t bConvTestIsBase64(uint8_t ucChar) {
+	return (ucChar != 0) && (strchr(acBase64Alphabet, ucChar) != libNULL);
+}
+
+static void vConvTestBase64RoundTrip(void) {
+	static char ref[4 * CONV_TEST_MAX + 16];
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = ulClTestRand() % (CONV_TEST_MAX + 1);
+		uint32_t offset = ulClTestRand() % 16;
+		uint8_t *data = &aucData[offset & 7];
+		uint8_t *text = &aucText[offset >> 1];
+		vConvTestRandom(data, len);
+		uint32_t refLen = ulConvTestBase64Ref(ref, data, len);
+		CL_TEST_CHECK(lBase64EncodeBufferRequired(len) >= (int32_t)refLen);
+		int32_t textLen = lBase64Encode(text, lBase64EncodeBufferRequired(len), data, len);
+		CL_TEST_CHECK(textLen == (int32_t)refLen);
+		CL_TEST_CHECK(memcmp(text, ref, refLen) == 0);
+		CL_TEST_CHECK(lBase64DecodeBufferRequired(text, refLen) == (int32_t)len);
+		int32_t outLen = lBase64Decode(aucOut, len, text, refLen);
+		CL_TEST_CHECK(outLen == (int32_t)len);
+		CL_TEST_CHECK(memcmp(aucOut, data, len) == 0);
+	}
+}
+
+static void vConvTestBase64Invalid(void) {
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = 1 + ulClTestRand() % CONV_TEST_MAX;
+		vConvTestRandom(aucData, len);
+		int32_t textLen = lBase64Encode(aucText, sizeof(aucText), aucData, len);
+		/* Padding chars are left as is */
+		uint32_t chars = textLen - (3 - len % 3) % 3;
+		uint32_t pos = ulClTestRand() % chars;
+		uint8_t bad;
+		do {
+			bad = (uint8_t)ulClTestRand();
+		} while (bConvTestIsBase64(bad) || (bad == '='));
+		aucText[pos] = bad;
+		CL_TEST_CHECK(lBase64Decode(aucOut, sizeof(aucOut), aucText, textLen) == -1);
+	}
+	/* Every byte value at every position of a block */
+	for (uint32_t c = 0; c < 256; c++) {
+		for (uint32_t pos = 0; pos < 8; pos++) {
+			uint8_t text[8];
+			memcpy(text, "QUJDREVG", 8);
+			text[pos] = (uint8_t)c;
+			int32_t res = lBase64Decode(aucOut, sizeof(aucOut), text, 8);
+			if (bConvTestIsBase64((uint8_t)c)) {
+				CL_TEST_CHECK(res == 6);
+			} else if ((c == '=') && (pos == 7)) {
+				CL_TEST_CHECK(res == 5);
+			} else {
+				CL_TEST_CHECK(res == -1);
+			}
+		}
+	}
+}
+
+static void vConvTestBase64Padding(void) {
+	static const struct {
+		const char *text;
+		int32_t res;
+	} cases[] = {
+		{"QQ==",         1},
+		{"QUI=",         2},
+		{"QUJD",         3},
+		{"QUJDQQ==",     4},
+		{"QUJDQUI=",     5},
+		{"=QUJ",        -1},
+		{"Q=UJ",        -1},
+		{"Q===",        -1},
+		{"====",        -1},
+		{"QQ=A",        -1},
+		{"QQ==QUJD",    -1},
+		{"QUI=QUJD",    -1},
+		{"QQ==QQ==",    -1},
+		{"QUJD=QUJ",    -1},
+		{"QUJDQ===",    -1},
+		{"QUJ",         -1},
+		{"QUJDQ",       -1},
+	};
+	for (uint32_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		int32_t res = lBase64Decode(aucOut, sizeof(aucOut), (const uint8_t *)cases[i].text, strlen(cases[i].text));
+		CL_TEST_CHECK(res == cases[i].res);
+		if (res != cases[i].res) printf("  \"%s\": %d\n", cases[i].text, (int)res);
+	}
+	/* Padding inside long text, kernels leave such blocks to scalar code */
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = 6 + ulClTestRand() % (CONV_TEST_MAX - 6);
+		vConvTestRandom(aucData, len);
+		len -= len % 3;
+		int32_t textLen = lBase64Encode(aucText, sizeof(aucText), aucData, len);
+		uint32_t block = ulClTestRand() % (textLen / 4 - 1);
+		uint32_t pos = ulClTestRand() % 4;
+		aucText[block * 4 + pos] = '=';
+		if (pos == 2) aucText[block * 4 + 3] = '=';
+		CL_TEST_CHECK(lBase64Decode(aucOut, sizeof(aucOut), aucText, textLen) == -1);
+	}
+}
+
+/* CP1251 0x80..0xFF code points, 0x98 is not mapped and gives zero byte */
+static const uint16_t ausCp1251High[128] = {
+	0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021, 0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+	0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+	0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+	0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+	0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+	0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+	0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+	0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F
+};
+
+/* Byte per step converter, pulEnds gets output length after every input char */
+static uint32_t ulConvTestUtf8Ref(uint8_t *pucOut, const uint8_t *pucStr, uint32_t ulLen, uint32_t *pulEnds) {
+	uint32_t n = 0;
+	for (uint32_t i = 0; i < ulLen; i++) {
+		uint32_t c = (pucStr[i] < 0x80)? pucStr[i]: ausCp1251High[pucStr[i] - 0x80];
+		if (c < 0x80) {
+			pucOut[n++] = (uint8_t)c;
+		} else if (c < 0x800) {
+			pucOut[n++] = (uint8_t)(0xC0 | (c >> 6));
+			pucOut[n++] = (uint8_t)(0x80 | (c & 0x3F));
+		} else {
+			pucOut[n++] = (uint8_t)(0xE0 | (c >> 12));
+			pucOut[n++] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+			pucOut[n++] = (uint8_t)(0x80 | (c & 0x3F));
+		}
+		pulEnds[i] = n;
+	}
+	return n;
+}
+
+/* Converts whole string, all output sizes for short strings */
+static void vConvTestUtf8Check(const uint8_t *pucStr, uint32_t ulLen, uint8_t bAllSizes) {
+	static uint8_t ref[3 * CONV_TEST_MAX + 16];
+	static uint32_t ends[CONV_TEST_MAX + 16];
+	uint32_t refLen = ulConvTestUtf8Ref(ref, pucStr, ulLen, ends);
+	CL_TEST_CHECK(ulAsciiToUtf8Mesure(pucStr, ulLen) == refLen);
+	memset(aucOut, 0xEE, sizeof(aucOut));
+	CL_TEST_CHECK(ulAsciiToUtf8(pucStr, ulLen, aucOut) == refLen);
+	CL_TEST_CHECK(memcmp(aucOut, ref, refLen) == 0);
+	CL_TEST_CHECK(aucOut[refLen] == 0xEE);
+	uint32_t sizes = bAllSizes? refLen + 1: 4;
+	for (uint32_t s = 0; s < sizes; s++) {
+		/* Last sizes are checked for long strings */
+		uint32_t size = bAllSizes? s: refLen - CL_MIN(refLen, s * (ulClTestRand() % 4));
+		uint32_t converted = 0xFFFFFFFF;
+		/* Output stops before the first char which does not fit */
+		uint32_t expected = 0;
+		while ((expected < ulLen) && (ends[expected] <= size)) expected++;
+		uint32_t expectedLen = expected? ends[expected - 1]: 0;
+		memset(aucOut, 0xEE, sizeof(aucOut));
+		CL_TEST_CHECK(ulAsciiToUtf8Bounded(pucStr, ulLen, aucOut, size, &converted) == expectedLen);
+		CL_TEST_CHECK(converted == expected);
+		CL_TEST_CHECK(memcmp(aucOut, ref, expectedLen) == 0);
+		CL_TEST_CHECK(aucOut[expectedLen] == 0xEE);
+	}
+}
+
+static void vConvTestUtf8(void) {
+	static uint8_t str[CONV_TEST_MAX + 16];
+	/* ASCII run with high byte at every offset, unaligned starts */
+	for (uint32_t len = 1; len <= 80; len++) {
+		for (uint32_t pos = 0; pos < len; pos++) {
+			uint32_t offset = (len + pos) & 7;
+			for (uint32_t i = 0; i < len; i++) {
+				str[offset + i] = (uint8_t)(' ' + ulClTestRand() % 95);
+			}
+			str[offset + pos] = (uint8_t)(0x80 | ulClTestRand());
+			vConvTestUtf8Check(&str[offset], len, len <= 32);
+		}
+	}
+	/* Random lengths, high bytes density from none to all */
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = ulClTestRand() % (CONV_TEST_MAX + 1);
+		uint32_t offset = ulClTestRand() % 16;
+		uint32_t density = ulClTestRand() % 65;
+		for (uint32_t i = 0; i < len; i++) {
+			uint32_t r = ulClTestRand();
+			str[offset + i] = ((r >> 8) % 64 < density)? (uint8_t)(0x80 | r): (uint8_t)(r & 0x7F);
+		}
+		vConvTestUtf8Check(&str[offset], len, len <= 64);
+	}
+	CL_TEST_CHECK(ulAsciiToUtf8Bounded((const uint8_t *)"ab", 2, libNULL, 8, libNULL) == 0);
+}
+
+static uint8_t bConvTestIsHex(uint8_t ucChar) {
+	return ((ucChar >= '0') && (ucChar <= '9')) || (((ucChar | 0x20) >= 'a') && ((ucChar | 0x20) <= 'f'));
+}
+
+static void vConvTestHexRoundTrip(void) {
+	static char ref[2 * CONV_TEST_MAX + 16];
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = ulClTestRand() % (CONV_TEST_MAX + 1);
+		uint32_t offset = ulClTestRand() % 16;
+		uint8_t upper = ulClTestRand() & 1;
+		uint8_t *data = &aucData[offset & 7];
+		uint8_t *text = &aucText[offset >> 1];
+		vConvTestRandom(data, len);
+		for (uint32_t i = 0; i < len; i++) {
+			snprintf(&ref[i * 2], 3, upper? "%02X": "%02x", data[i]);
+		}
+		memset(text, 0xEE, 2 * len + 1);
+		CL_TEST_CHECK(lHexEncode(text, data, len, upper) == (int32_t)(2 * len));
+		CL_TEST_CHECK(memcmp(text, ref, 2 * len) == 0);
+		CL_TEST_CHECK(text[2 * len] == 0xEE);
+		/* Random letter case */
+		for (uint32_t i = 0; i < 2 * len; i++) {
+			if ((text[i] > '9') && (ulClTestRand() & 1)) text[i] ^= 0x20;
+		}
+		memset(aucOut, 0xEE, len + 1);
+		CL_TEST_CHECK(lHexDecode(aucOut, text, 2 * len) == (int32_t)len);
+		CL_TEST_CHECK(memcmp(aucOut, data, len) == 0);
+		CL_TEST_CHECK(aucOut[len] == 0xEE);
+	}
+}
+
+static void vConvTestHexInvalid(void) {
+	for (uint32_t round = 0; round < CONV_TEST_ROUNDS; round++) {
+		uint32_t len = 1 + ulClTestRand() % CONV_TEST_MAX;
+		uint32_t offset = ulClTestRand() % 16;
+		uint8_t *text = &aucText[offset];
+		vConvTestRandom(aucData, len);
+		lHexEncode(text, aucData, len, ulClTestRand() & 1);
+		uint32_t pos = ulClTestRand() % (2 * len);
+		uint8_t bad;
+		do {
+			bad = (uint8_t)ulClTestRand();
+		} while (bConvTestIsHex(bad));
+		text[pos] = bad;
+		int32_t res = lHexDecode(aucOut, text, 2 * len);
+		CL_TEST_CHECK(res < -1);
+		CL_TEST_CHECK(HEX_DECODE_ERROR_POSITION(res) == pos);
+		/* First invalid char is reported */
+		uint32_t second = pos + ulClTestRand() % (2 * len - pos);
+		text[second] = 'g';
+		res = lHexDecode(aucOut, text, 2 * len);
+		CL_TEST_CHECK(HEX_DECODE_ERROR_POSITION(res) == pos);
+		/* Odd length reports the last char if everything before is valid */
+		lHexEncode(text, aucData, len, CL_TRUE);
+		res = lHexDecode(aucOut, text, 2 * len - 1);
+		CL_TEST_CHECK(res < -1);
+		CL_TEST_CHECK(HEX_DECODE_ERROR_POSITION(res) == 2 * len - 2);
+	}
+	/* Every byte value at both nibble positions */
+	for (uint32_t c = 0; c < 256; c++) {
+		uint8_t text[2] = {(uint8_t)c, 'a'};
+		uint8_t byte;
+		int32_t res = lHexDecode(&byte, text, 2);
+		CL_TEST_CHECK(bConvTestIsHex((uint8_t)c)? (res == 1): (HEX_DECODE_ERROR_POSITION(res) == 0));
+		text[0] = 'F';
+		text[1] = (uint8_t)c;
+		res = lHexDecode(&byte, text, 2);
+		CL_TEST_CHECK(bConvTestIsHex((uint8_t)c)? (res == 1): (HEX_DECODE_ERROR_POSITION(res) == 1));
+	}
+	CL_TEST_CHECK(lHexDecode(libNULL, (const uint8_t *)"00", 2) == -1);
+	CL_TEST_CHECK(lHexDecode(aucOut, (const uint8_t *)"", 0) == 0);
+}
+
+int main(void) {
+	vConvTestBase64RoundTrip();
+	vConvTestBase64Invalid();
+	vConvTestBase64Padding();
+	vConvTestUtf8();
+	vConvTestHexRoundTrip();
+	vConvTestHexInvalid();
+	return CL_TEST_RESULT();
+}
@@ -0,0 +1,232 @@
+/*!
+    CrcTest.c
+
+    CRC_32_* catalogue check values, table, slicing-by-8 and x86 kernels against
+    bitwise engine the library had before, incremental contexts, combine and
+    parallel calculation. CRC16 Modbus and CRC8 Dallas against former bitwise code.
+*/
+#include <string.h>
+#include "ClTest.h"
+
+#define CRC_TEST_DATA       (1024 * 1024 + 13)
+
+/* Former bitwise engine, MSB first with reflected bytes for reflected input */
+static uint32_t ulCrcTestRef32(const uint8_t *pucData, uint32_t ulLen, uint32_t ulInit, uint32_t ulPoly, Crc32Options_t eOpt) {
+	uint32_t crc = ulInit;
+	while (ulLen--) {
+		uint8_t b = *pucData++;
+		if (eOpt & CRC32_REFLECT_IN) b = ulBitReflect(b, 8);
+		crc ^= (uint32_t)b << 24;
+		for (int bit = 0; bit < 8; bit++) {
+			crc = (crc & (1UL << 31))? ((crc << 1) ^ ulPoly): (crc << 1);
+		}
+	}
+	if (eOpt & CRC32_INVERT_OUT) crc = ~crc;
+	if (eOpt & CRC32_REFLECT_OUT) crc = ulBitReflect(crc, 32);
+	return crc;
+}
+
+static uint16_t usCrcTestRef16(const uint8_t *pucData, uint32_t ulLen, uint16_t usCrc) {
+	while (ulLen--) {
+		usCrc ^= *pucData++;
+		for (int bit = 0; bit < 8; bit++) {
+			usCrc = (usCrc & 1)? ((usCrc >> 1) ^ 0xA001): (usCrc >> 1);
+		}
+	}
+	return usCrc;
+}
+
+static uint8_t ucCrcTestRef8(const uint8_t *pucData, uint32_t ulLen, uint8_t ucCrc) {
+	static const uint8_t bitComp[] = { 0x5e, 0xbc, 0x61, 0xc2, 0x9d, 0x23, 0x46, 0x8c };
+	while (ulLen--) {
+		uint8_t data = *pucData++ ^ ucCrc;
+		uint8_t crc = 0;
+		for (int bit = 0; bit < 8; bit++) {
+			crc ^= (data & (1 << bit))? bitComp[bit]: 0;
+		}
+		ucCrc = (uint8_t)((crc << 4) | (crc >> 4));
+	}
+	return ucCrc;
+}
+
+typedef struct {
+	const char *name;
+	uint32_t init;
+	uint32_t poly;
+	Crc32Options_t opt;
+	uint32_t check;
+} CrcTestModel_t;
+
+/* Parameters of CRC_32_* macros, check values of "123456789" from CRC catalogue */
+static const CrcTestModel_t axModels[] = {
+	{"AIXM",       0x00000000, 0x814141AB, 0,                                                        0x3010BF7F},
+	{"AUTOSAR",    0xFFFFFFFF, 0xF4ACFB13, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT, 0x1697D06A},
+	{"BASE91-D",   0xFFFFFFFF, 0xA833982B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT, 0x87315576},
+	{"BZIP2",      0xFFFFFFFF, 0x04C11DB7, CRC32_INVERT_OUT,                                         0xFC891918},
+	{"CD-ROM-EDC", 0x00000000, 0x8001801B, CRC32_REFLECT_IN | CRC32_REFLECT_OUT,                    0x6EC2EDC4},
+	{"CKSUM",      0x00000000, 0x04C11DB7, CRC32_INVERT_OUT,                                         0x765E7680},
+	{"ISCSI",      0xFFFFFFFF, 0x1EDC6F41, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT, 0xE3069283},
+	{"ISO-HDLC",   0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT | CRC32_INVERT_OUT, 0xCBF43926},
+	{"JAMCRC",     0xFFFFFFFF, 0x04C11DB7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT,                    0x340BC6D9},
+	{"MEF",        0xFFFFFFFF, 0x741B8CD7, CRC32_REFLECT_IN | CRC32_REFLECT_OUT,                    0xD2C22F51},
+	{"MPEG-2",     0xFFFFFFFF, 0x04C11DB7, 0,                                                        0x0376E6E7},
+	{"XFER",       0x00000000, 0x000000AF, 0,                                                        0xBD0BE338},
+};
+#define CRC_TEST_MODELS     (sizeof(axModels) / sizeof(axModels[0]))
+
+static const char acCheck[] = "123456789";
+static uint8_t aucData[CRC_TEST_DATA];
+static Crc32Table_t axTables[CRC_TEST_MODELS];
+
+static void vCrcTestMacros(void) {
+	CL_TEST_CHECK(CRC_32_AIXM(acCheck, 9) == 0x3010BF7F);
+	CL_TEST_CHECK(CRC_32_AUTOSAR(acCheck, 9) == 0x1697D06A);
+	CL_TEST_CHECK(CRC_32_BASE91_D(acCheck, 9) == 0x87315576);
+	CL_TEST_CHECK(CRC_32_BZIP2(acCheck, 9) == 0xFC891918);
+	CL_TEST_CHECK(CRC_32_CD_ROM_EDC(acCheck, 9) == 0x6EC2EDC4);
+	CL_TEST_CHECK(CRC_32_CKSUM(acCheck, 9) == 0x765E7680);
+	CL_TEST_CHECK(CRC_32_ISCSI(acCheck, 9) == 0xE3069283);
+	CL_TEST_CHECK(CRC_32_ISO_HDLC(acCheck, 9) == 0xCBF43926);
+	CL_TEST_CHECK(CRC_32_JAMCRC(acCheck, 9) == 0x340BC6D9);
+	CL_TEST_CHECK(CRC_32_MEF(acCheck, 9) == 0xD2C22F51);
+	CL_TEST_CHECK(CRC_32_MPEG_2(acCheck, 9) == 0x0376E6E7);
+	CL_TEST_CHECK(CRC_32_XFER(acCheck, 9) == 0xBD0BE338);
+	for (uint32_t m = 0; m < CRC_TEST_MODELS; m++) {
+		const CrcTestModel_t *model = &axModels[m];
+		CL_TEST_CHECK(ulCrcTestRef32((const uint8_t *)acCheck, 9, model->init, model->poly, model->opt) == model->check);
+		CL_TEST_CHECK(ulCrc32Table(&axTables[m], acCheck, 9, model->init, model->opt) == model->check);
+	}
+	CL_TEST_CHECK(usCrc16ModbusRtu((const uint8_t *)acCheck, 9, libNULL) == 0x4B37);
+}
+
+/*
+  Short lengths cover byte tails and slicing-by-8 steps, long ones x86 kernels for
+  ISCSI and ISO-HDLC when CPU has them, with all 16 byte alignments of start.
+ */
+static void vCrcTestEngines(void) {
+	for (uint32_t m = 0; m < CRC_TEST_MODELS; m++) {
+		const CrcTestModel_t *model = &axModels[m];
+		for (uint32_t offset = 0; offset < 16; offset++) {
+			for (uint32_t len = 0; len <= 64; len++) {
+				uint32_t ref = ulCrcTestRef32(aucData + offset, len, model->init, model->poly, model->opt);
+				CL_TEST_CHECK(ulCrc32(aucData + offset, len, model->init, model->poly, model->opt) == ref);
+				CL_TEST_CHECK(ulCrc32Table(&axTables[m], aucData + offset, len, model->init, model->opt) == ref);
+			}
+			for (uint32_t i = 0; i < 8; i++) {
+				uint32_t len = 65 + ulClTestRand() % 4096;
+				uint32_t ref = ulCrcTestRef32(aucData + offset, len, model->init, model->poly, model->opt);
+				CL_TEST_CHECK(ulCrc32(aucData + offset, len, model->init, model->poly, model->opt) == ref);
+				CL_TEST_CHECK(ulCrc32Table(&axTables[m], aucData + offset, len, model->init, model->opt) == ref);
+			}
+		}
+	}
+}
+
+/* Random chunks through contexts with and without tables, random split points for combine */
+static void vCrcTestIncremental(void) {
+	for (uint32_t m = 0; m < CRC_TEST_MODELS; m++) {
+		const CrcTestModel_t *model = &axModels[m];
+		for (uint32_t i = 0; i < 16; i++) {
+			uint32_t len = ulClTestRand() % 8192;
+			uint32_t ref = ulCrcTestRef32(aucData, len, model->init, model->poly, model->opt);
+			Crc32Context_t plain, table;
+			vCrc32Init(&plain, model->init, model->poly, model->opt, libNULL);
+			vCrc32Init(&table, model->init, 0, model->opt, &axTables[m]);
+			for (uint32_t done = 0; done < len; ) {
+				uint32_t chunk = ulClTestRand() % 300;
+				chunk = CL_MIN(chunk, len - done);
+				vCrc32Update(&plain, aucData + done, chunk);
+				vCrc32Update(&table, aucData + done, chunk);
+				done += chunk;
+			}
+			CL_TEST_CHECK(ulCrc32Final(&plain) == ref);
+			CL_TEST_CHECK(ulCrc32Final(&table) == ref);
+			uint32_t split = len? (ulClTestRand() % (len + 1)): 0;
+			uint32_t crcA = ulCrc32(aucData, split, model->init, model->poly, model->opt);
+			uint32_t crcB = ulCrc32(aucData + split, len - split, model->init, model->poly, model->opt);
+			CL_TEST_CHECK(ulCrc32Combine(crcA, crcB, len - split, model->init, model->poly, model->opt) == ref);
+		}
+	}
+}
+
+/* Executor running jobs one by one in calling thread, any order must give the same result */
+static void vCrcTestRunBackwards(void (*pfJob)(void *pvArg), void **ppvArgs, uint32_t ulCount, void *pvCtx) {
+	libUNUSED(pvCtx);
+	while (ulCount--) {
+		pfJob(ppvArgs[ulCount]);
+	}
+}
+
+static void vCrcTestParallel(void) {
+	static const uint32_t threads[] = {1, 2, 3, 8, CRC32_PARALLEL_MAX_SLICES + 4};
+	const uint32_t m = 7; /* ISO-HDLC */
+	const CrcTestModel_t *model = &axModels[m];
+	uint32_t ref = ulCrcTestRef32(aucData, CRC_TEST_DATA, model->init, model->poly, model->opt);
+	for (uint32_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+		CL_TEST_CHECK(ulCrc32Parallel(aucData, CRC_TEST_DATA, threads[t], model->init, model->poly, model->opt,
+			&axTables[m], vCrcTestRunBackwards, libNULL) == ref);
+		CL_TEST_CHECK(ulCrc32Parallel(aucData, CRC_TEST_DATA, threads[t], model->init, model->poly, model->opt,
+			libNULL, vCrcTestRunBackwards, libNULL) == ref);
+		CL_TEST_CHECK(ulCrc32Parallel(aucData, CRC_TEST_DATA, threads[t], model->init, model->poly, model->opt,
+			&axTables[m], libNULL, libNULL) == ref);
+#ifdef CL_CRC_PTHREADS
+		CL_TEST_CHECK(ulCrc32Parallel(aucData, CRC_TEST_DATA, threads[t], model->init, model->poly, model->opt,
+			&axTables[m], vCrcRunPthreads, libNULL) == ref);
+#endif
+	}
+	/* Normal form model goes through the same slicing */
+	const CrcTestModel_t *bzip2 = &axModels[3];
+	CL_TEST_CHECK(ulCrc32Parallel(aucData, CRC_TEST_DATA, 5, bzip2->init, bzip2->poly, bzip2->opt,
+		&axTables[3], vCrcTestRunBackwards, libNULL) == ulCrcTestRef32(aucData, CRC_TEST_DATA, bzip2->init, bzip2->poly, bzip2->opt));
+}
+
+/* One-shot and incremental CRC16 Modbus and CRC8 Dallas, slicing-by-4 builds included */
+static void vCrcTestShort(void) {
+	for (uint32_t offset = 0; offset < 4; offset++) {
+		for (uint32_t len = 0; len <= 300; len++) {
+			const uint8_t *data = aucData + offset;
+			uint16_t ref16 = usCrcTestRef16(data, len, 0xFFFF);
+			uint8_t ref8 = ucCrcTestRef8(data, len, 0);
+			CL_TEST_CHECK(usCrc16ModbusRtu(data, len, libNULL) == ref16);
+			CL_TEST_CHECK(ucCrc8Dallas(data, len, libNULL) == ref8);
+			Crc16Context_t ctx16;
+			Crc8Context_t ctx8;
+			vCrc16ModbusRtuInit(&ctx16);
+			vCrc8DallasInit(&ctx8);
+			for (uint32_t done = 0; done < len; ) {
+				uint32_t chunk = ulClTestRand() % 11;
+				chunk = CL_MIN(chunk, len - done);
+				vCrc16ModbusRtuUpdate(&ctx16, data + done, chunk);
+				vCrc8DallasUpdate(&ctx8, data + done, chunk);
+				done += chunk;
+			}
+			CL_TEST_CHECK(usCrc16ModbusRtuFinal(&ctx16) == ref16);
+			CL_TEST_CHECK(ucCrc8DallasFinal(&ctx8) == ref8);
+			/* Continuation from previous value */
+			uint16_t crc16 = usCrc16ModbusRtu(data, len / 2, libNULL);
+			uint8_t crc8 = ucCrc8Dallas(data, len / 2, libNULL);
+			CL_TEST_CHECK(usCrc16ModbusRtu(data + len / 2, len - len / 2, &crc16) == ref16);
+			CL_TEST_CHECK(ucCrc8Dallas(data + len / 2, len - len / 2, &crc8) == ref8);
+		}
+	}
+}
+
+int main(void) {
+	for (uint32_t i = 0; i < CRC_TEST_DATA; i++) {
+		aucData[i] = (uint8_t)ulClTestRand();
+	}
+	for (uint32_t m = 0; m < CRC_TEST_MODELS; m++) {
+		vCrc32TableInit(&axTables[m], axModels[m].poly, axModels[m].opt);
+	}
+#ifdef CL_SIMD_X86
+	uint32_t features = ulClCpuFeatures();
+	printf("sse4.2 crc32: %s, pclmul: %s\n", (features & CL_CPU_SSE42)? "yes": "no",
+		((features & CL_CPU_PCLMUL) && (features & CL_CPU_SSE41))? "yes": "no");
+#endif
+	vCrcTestMacros();
+	vCrcTestEngines();
+	vCrcTestIncremental();
+	vCrcTestParallel();
+	vCrcTestShort();
+	return CL_TEST_RESULT();
+}
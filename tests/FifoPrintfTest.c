@@ -0,0 +1,131 @@
+/*!
+    FifoPrintfTest.c
+
+    Producer threads print records longer than any internal chunk into one fifo over
+    MpscBuffer, consumer checks that every record arrives whole and in per-producer order.
+    Fifo over CircularBuffer keeps partial pass-through writes.
+*/
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "ClTest.h"
+#include "ClFifoIface.h"
+
+#define FIFO_PRINTF_TEST_PRODUCERS   4
+#define FIFO_PRINTF_TEST_RECORDS     20000
+#define FIFO_PRINTF_TEST_STORAGE     1024
+
+static Fifo_t xFifo = { .pxIface = &xClFifoMpscIface, .pxIfaceEx = &xClFifoMpscIfaceEx };
+static volatile uint8_t bStop;
+static uint8_t aucStorage[FIFO_PRINTF_TEST_STORAGE];
+static const char acPad[] = "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/* Record: "<producer> <number> <pad length> <pad>\n", pad length varies over 0..185 */
+static void *pvFifoPrintfTestProducer(void *pvArg) {
+	uint32_t id = (uint32_t)(size_t)pvArg;
+	for (uint32_t i = 0; i < FIFO_PRINTF_TEST_RECORDS; i++) {
+		uint32_t pad = (i * 7 + id * 13) % (sizeof(acPad) - 1);
+		while (!bStop && (lFifoPrintf(&xFifo, "%u %u %u %.*s\n", id, i, pad, pad, acPad) == 0)) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static uint32_t ulFifoPrintfTestParse(const char **ppcLine) {
+	uint32_t value = 0;
+	while ((**ppcLine >= '0') && (**ppcLine <= '9')) {
+		value = value * 10 + (*(*ppcLine)++ - '0');
+	}
+	if (**ppcLine == ' ') {
+		(*ppcLine)++;
+	}
+	return value;
+}
+
+static void vFifoPrintfTestConcurrent(void) {
+	pthread_t producers[FIFO_PRINTF_TEST_PRODUCERS];
+	uint32_t next[FIFO_PRINTF_TEST_PRODUCERS] = {0};
+	char line[256];
+	uint32_t lineLen = 0, records = 0;
+	CL_TEST_CHECK(bFifoInit(&xFifo, aucStorage, sizeof(aucStorage), 0));
+	for (uint32_t i = 0; i < FIFO_PRINTF_TEST_PRODUCERS; i++) {
+		pthread_create(&producers[i], NULL, pvFifoPrintfTestProducer, (void *)(size_t)i);
+	}
+	while ((records < FIFO_PRINTF_TEST_PRODUCERS * FIFO_PRINTF_TEST_RECORDS) && !_ulClTestFailed) {
+		uint8_t ch;
+		if (!bFifoReadByte(&xFifo, &ch)) {
+			sched_yield();
+			continue;
+		}
+		if (ch != '\n') {
+			CL_TEST_CHECK(lineLen < sizeof(line) - 1);
+			line[lineLen++] = ch;
+			continue;
+		}
+		line[lineLen] = '\0';
+		const char *cursor = line;
+		uint32_t id = ulFifoPrintfTestParse(&cursor);
+		uint32_t number = ulFifoPrintfTestParse(&cursor);
+		uint32_t pad = ulFifoPrintfTestParse(&cursor);
+		CL_TEST_CHECK(id < FIFO_PRINTF_TEST_PRODUCERS);
+		if (id < FIFO_PRINTF_TEST_PRODUCERS) {
+			CL_TEST_CHECK(number == next[id]);
+			next[id] = number + 1;
+		}
+		CL_TEST_CHECK(strlen(cursor) == pad);
+		CL_TEST_CHECK(memcmp(cursor, acPad, pad) == 0);
+		if (_ulClTestFailed) {
+			printf("record: %s\n", line);
+		}
+		lineLen = 0;
+		records++;
+	}
+	bStop = 1;
+	for (uint32_t i = 0; i < FIFO_PRINTF_TEST_PRODUCERS; i++) {
+		pthread_join(producers[i], NULL);
+	}
+	CL_TEST_CHECK(_ulClTestFailed || (lFifoAvailableToRead(&xFifo) == 0));
+}
+
+static void vFifoPrintfTestMpscLimits(void) {
+	static uint8_t storage[128];
+	uint8_t out[128];
+	/* Record larger than free space is not writed at all */
+	Fifo_t mpsc = { .pxIface = &xClFifoMpscIface, .pxIfaceEx = &xClFifoMpscIfaceEx };
+	CL_TEST_CHECK(bFifoInit(&mpsc, storage, sizeof(storage), 0));
+	int32_t space = lFifoAvailableToWrite(&mpsc);
+	CL_TEST_CHECK(lFifoPrintf(&mpsc, "%.*s", space - 4, acPad) == space - 4);
+	CL_TEST_CHECK(lFifoPrintf(&mpsc, "%s", "abcdef") == 0);
+	CL_TEST_CHECK(lFifoPrintInteger(&mpsc, 1234, 0) == 4);
+	CL_TEST_CHECK(lFifoRead(&mpsc, out, sizeof(out)) == space);
+	CL_TEST_CHECK(memcmp(out + space - 4, "1234", 4) == 0);
+	/* Wrapped claim */
+	CL_TEST_CHECK(lFifoPrintf(&mpsc, "%.*s", 20, acPad) == 20);
+	CL_TEST_CHECK(lFifoRead(&mpsc, out, sizeof(out)) == 20);
+	CL_TEST_CHECK(memcmp(out, acPad, 20) == 0);
+}
+
+/* Buffer without claims keeps pass-through writes, record is cut at free space */
+static void vFifoPrintfTestCbLimits(void) {
+	static uint8_t storage[128];
+	uint8_t out[128];
+	Fifo_t cb = { .pxIface = &xClFifoCbIface };
+	CL_TEST_CHECK(bFifoInit(&cb, storage, sizeof(storage), 0));
+	CL_TEST_CHECK(lFifoWriteClaim(&cb, 0, (uint8_t *[2]){0}, &(uint32_t){0}) < 0);
+	int32_t space = lFifoAvailableToWrite(&cb);
+	CL_TEST_CHECK(lFifoPrintf(&cb, "%.*s", space + 10, acPad) == space);
+	CL_TEST_CHECK(lFifoRead(&cb, out, sizeof(out)) == space);
+	CL_TEST_CHECK(memcmp(out, acPad, space) == 0);
+}
+
+int main(void) {
+	vFifoPrintfTestCbLimits();
+	if (CL_FIFO_IFACE_USED) {
+		vFifoPrintfTestMpscLimits();
+		vFifoPrintfTestConcurrent();
+	}
+	return CL_TEST_RESULT();
+}
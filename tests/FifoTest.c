@@ -0,0 +1,97 @@
+/*!
+    FifoTest.c
+
+    Fifo over CircularBuffer: write reserve and commit, single and double bufferization.
+*/
+#include <string.h>
+#include "ClTest.h"
+#include "ClFifoIface.h"
+
+static void vFifoTestReserve(uint8_t bDouble) {
+	static uint8_t storage[256];
+	Fifo_t fifo = { .pxIface = &xClFifoCbIface, .pxIfaceEx = &xClFifoCbIfaceEx };
+	uint8_t *space, out[16];
+	BufferSize_t len;
+	CL_TEST_CHECK(bFifoInit(&fifo, storage, sizeof(storage), bDouble));
+	CL_TEST_CHECK(lFifoWrite(&fifo, (const uint8_t *)"ab", 2) == 2);
+	CL_TEST_CHECK(bFifoWriteReserve(&fifo, 4, &space, &len));
+	CL_TEST_CHECK(len >= 4);
+	/* One reservation at a time, writes would land under reserved space */
+	CL_TEST_CHECK(!bFifoWriteReserve(&fifo, 4, &space, &len));
+	CL_TEST_CHECK(lFifoWrite(&fifo, (const uint8_t *)"xy", 2) == -1);
+	CL_TEST_CHECK(lFifoWriteAll(&fifo, (const uint8_t *)"xy", 2) == -1);
+	CL_TEST_CHECK(!bFifoWriteByte(&fifo, 'x'));
+	CL_TEST_CHECK(lFifoFill(&fifo, 'x', 2) == -1);
+	CL_TEST_CHECK(lFifoFillAll(&fifo, 'x', 2) == -1);
+	CL_TEST_CHECK(lFifoWriteString(&fifo, "xy") == -1);
+	CL_TEST_CHECK(lFifoWriteStringAll(&fifo, "xy") == -1);
+	memcpy(space, "cdef", 4);
+	CL_TEST_CHECK(bFifoWriteCommit(&fifo, 4));
+	CL_TEST_CHECK(!bFifoWriteCommit(&fifo, 1));
+	CL_TEST_CHECK(lFifoWrite(&fifo, (const uint8_t *)"g", 1) == 1);
+	CL_TEST_CHECK(lFifoRead(&fifo, out, sizeof(out)) == 7);
+	CL_TEST_CHECK(memcmp(out, "abcdefg", 7) == 0);
+}
+
+/* Reserve without commit hook would leave fifo reserved forever */
+static void vFifoTestReserveNoCommit(void) {
+	static uint8_t storage[64];
+	static const FifoIfaceEx_t ifaceEx = { .pfBufferWriteReserve = _lClCbReserve };
+	Fifo_t fifo = { .pxIface = &xClFifoCbIface, .pxIfaceEx = &ifaceEx };
+	uint8_t *space;
+	CL_TEST_CHECK(bFifoInit(&fifo, storage, sizeof(storage), 0));
+	CL_TEST_CHECK(!bFifoWriteReserve(&fifo, 1, &space, libNULL));
+	CL_TEST_CHECK(!bFifoWriteCommit(&fifo, 1));
+	CL_TEST_CHECK(lFifoWrite(&fifo, (const uint8_t *)"ab", 2) == 2);
+}
+
+/* Random writes, reads and shifts keep byte order and availability across buffer switches */
+static void vFifoTestRandom(uint8_t bDouble) {
+	static uint8_t storage[128];
+	Fifo_t fifo = { .pxIface = &xClFifoCbIface, .pxIfaceEx = &xClFifoCbIfaceEx };
+	uint8_t chunk[64];
+	uint8_t wrValue = 0, rdValue = 0;
+	int32_t stored = 0;
+	CL_TEST_CHECK(bFifoInit(&fifo, storage, sizeof(storage), bDouble));
+	for (uint32_t i = 0; (i < 20000) && !_ulClTestFailed; i++) {
+		uint32_t op = ulClTestRand();
+		uint32_t len = (op >> 8) % sizeof(chunk) + 1;
+		if ((op & 3) == 0) {
+			for (uint32_t k = 0; k < len; k++) {
+				chunk[k] = (uint8_t)(wrValue + k);
+			}
+			int32_t writed = lFifoWrite(&fifo, chunk, len);
+			CL_TEST_CHECK((writed >= 0) && ((uint32_t)writed <= len));
+			wrValue += writed;
+			stored += writed;
+		}
+		else if ((op & 3) == 1) {
+			int32_t readed = lFifoRead(&fifo, chunk, len);
+			CL_TEST_CHECK(readed == CL_MIN((int32_t)len, stored));
+			for (int32_t k = 0; k < readed; k++) {
+				CL_TEST_CHECK(chunk[k] == rdValue++);
+			}
+			stored -= readed;
+		}
+		else if ((op & 3) == 2) {
+			int32_t removed = lFifoShift(&fifo, len);
+			CL_TEST_CHECK(removed == CL_MIN((int32_t)len, stored));
+			rdValue += removed;
+			stored -= removed;
+		}
+		else {
+			CL_TEST_CHECK(lFifoAvailableToRead(&fifo) == stored);
+		}
+	}
+}
+
+int main(void) {
+	vFifoTestReserve(0);
+	vFifoTestReserve(1);
+	if (CL_FIFO_IFACE_USED) {
+		vFifoTestReserveNoCommit();
+	}
+	vFifoTestRandom(0);
+	vFifoTestRandom(1);
+	return CL_TEST_RESULT();
+}
@@ -0,0 +1,91 @@
+/*!
+    SpscBufferTest.c
+
+    Producer and consumer threads move byte sequence through small SpscCircularBuffer
+    with random chunk sizes, consumer checks that sequence arrives intact across wraparounds.
+*/
+#include <pthread.h>
+#include <sched.h>
+#include "ClTest.h"
+
+#define SPSC_TEST_SIZE       64
+#define SPSC_TEST_BYTES      (4UL * 1024 * 1024)
+/* Prime period, sequence never lines up with buffer size */
+#define SPSC_TEST_PERIOD     251
+
+static SpscCircularBuffer_t xSpsc;
+static uint8_t aucSpscStorage[SPSC_TEST_SIZE];
+
+static void *pvSpscTestProducer(void *pvArg) {
+	libUNUSED(pvArg);
+	uint32_t seed = 0x12345678;
+	uint8_t chunk[SPSC_TEST_SIZE];
+	uint8_t value = 0;
+	for (uint32_t sent = 0; sent < SPSC_TEST_BYTES; ) {
+		seed = seed * 1103515245 + 12345;
+		uint32_t len = CL_MIN((seed >> 16) % SPSC_TEST_SIZE + 1, SPSC_TEST_BYTES - sent);
+		if (len == 1) {
+			while (!bScbSpscPush(&xSpsc, value)) {
+				sched_yield();
+			}
+			value = (value + 1) % SPSC_TEST_PERIOD;
+			sent++;
+			continue;
+		}
+		uint8_t next = value;
+		for (uint32_t i = 0; i < len; i++) {
+			chunk[i] = next;
+			next = (next + 1) % SPSC_TEST_PERIOD;
+		}
+		uint32_t done = 0;
+		while (done < len) {
+			int32_t res = scb_spsc_write(&xSpsc, chunk + done, len - done);
+			if (res == 0) {
+				sched_yield();
+			}
+			done += res;
+		}
+		value = next;
+		sent += len;
+	}
+	return NULL;
+}
+
+int main(void) {
+	pthread_t producer;
+	uint32_t seed = 0x87654321;
+	uint8_t chunk[SPSC_TEST_SIZE];
+	uint8_t expected = 0;
+	uint32_t received = 0;
+	vScbSpscInit(&xSpsc, aucSpscStorage, SPSC_TEST_SIZE);
+	CL_TEST_CHECK(pthread_create(&producer, NULL, pvSpscTestProducer, NULL) == 0);
+	while ((received < SPSC_TEST_BYTES) && !_ulClTestFailed) {
+		seed = seed * 1103515245 + 12345;
+		uint32_t len = (seed >> 16) % SPSC_TEST_SIZE + 1;
+		int32_t res;
+		if (len == 1) {
+			res = bScbSpscPop(&xSpsc, chunk);
+		}
+		else {
+			res = scb_spsc_read(&xSpsc, chunk, len);
+			CL_TEST_CHECK((res >= 0) && (res <= (int32_t)len));
+		}
+		if (res <= 0) {
+			sched_yield();
+			continue;
+		}
+		for (int32_t i = 0; i < res; i++) {
+			if (chunk[i] != expected) {
+				CL_TEST_CHECK(chunk[i] == expected);
+				printf("offset %u\n", received + i);
+				break;
+			}
+			expected = (expected + 1) % SPSC_TEST_PERIOD;
+		}
+		received += res;
+	}
+	CL_TEST_CHECK(received == SPSC_TEST_BYTES);
+	CL_TEST_CHECK(lScbSpscAvailable(&xSpsc) == 0);
+	pthread_join(producer, NULL);
+	return CL_TEST_RESULT();
+}